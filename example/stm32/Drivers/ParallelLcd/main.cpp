@@ -0,0 +1,54 @@
+#include <zhele/clock.h>
+#include <zhele/dma.h>
+#include <zhele/iopins.h>
+#include <zhele/pinlist.h>
+#include <zhele/timer.h>
+#include <zhele/drivers/parallel_bus.h>
+#include <zhele/drivers/st7735.h>
+#include <zhele/drivers/fonts.h>
+
+using namespace Zhele;
+using namespace Zhele::Clock;
+using namespace Zhele::IO;
+using namespace Zhele::Drivers;
+using namespace Zhele::Timers;
+
+// 8-bit 8080 bus: data on PB0..PB7, WR on PA8 (TIM1_CH1), pixels are streamed by TIM1 + DMA1 channel 2 (TIM1_CH1 request)
+using DataPins = PinList<Pb0, Pb1, Pb2, Pb3, Pb4, Pb5, Pb6, Pb7>;
+using Bus = ParallelBus<DataPins, Pa8, Pa3, Pa1, Pa2, ParallelBusMode::Intel8080, ParallelBusDma<Timer1, 0, Dma1Channel2>>;
+
+using Lcd = St7735<Bus, Bus::CsPin, Bus::DcPin, Pa4, 160, 128>;
+
+int main()
+{
+    Pa4::Port::Enable();
+    Pa4::SetConfiguration(Pa4::Configuration::Out);
+    Pa4::SetDriverType(Pa4::DriverType::PushPull);
+
+    // PB3/PB4 belong to JTAG after reset: keep SW-DP only and release them for the data bus
+    AfioClock::Enable();
+    SwjRemap::Set(2);
+
+    Bus::Init();
+
+    // Init display
+    Lcd::Init();
+    // Fill with black color (by timer and DMA)
+    Lcd::FillScreen(Lcd::Color::Black);
+    // Wait for complete (fill operation is async)
+    while(Lcd::Busy()) continue;
+
+    Lcd::WriteString<TimesNewRoman13>(10, 10, "Parallel bus", Lcd::Color::White, Lcd::Color::Black);
+
+    for (;;)
+    {
+    }
+}
+
+extern "C"
+{
+    void TIM1_UP_IRQHandler()
+    {
+        Bus::IrqHandler();
+    }
+}
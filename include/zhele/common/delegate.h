@@ -0,0 +1,209 @@
+/**
+ * @file
+ * Implements delegate (callback with bound context)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_COMMON_DELEGATE_H
+#define ZHELE_COMMON_DELEGATE_H
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace Zhele
+{
+    template<typename _Signature>
+    class Delegate;
+
+    /**
+     * @brief Callback with bound context
+     *
+     * @details
+     * Delegate is two pointers: context and stub. It does not allocate memory and has no
+     * virtual calls, so it costs as much as function pointer. Function known at compile time
+     * (Bind<&Function> or Bind<&Class::Method>(object)) is inlined into stub.
+     *
+     * Delegate can be constructed implicitly from function pointer, captureless lambda
+     * and nullptr, so code written for function pointers compiles without changes.
+     * Stateful callable (lambda with captures, functor) is bound by reference: it must outlive
+     * delegate (be static or wait for callback completion). Temporary stateful callable is rejected.
+     *
+     * @par Example
+     * @code
+     * struct Sensor { void OnComplete(void* data, unsigned size, bool success); };
+     * Sensor sensor;
+     * Dma1Channel1::SetTransferCallback(DmaChannelData::TransferCallback::Bind<&Sensor::OnComplete>(sensor));
+     *
+     * volatile bool complete = false;
+     * auto onComplete = [&complete](void*, unsigned, bool) { complete = true; };
+     * Dma1Channel1::SetTransferCallback(onComplete);
+     * @endcode
+     *
+     * @tparam _Return Return type
+     * @tparam _Args Arguments types
+     */
+    template<typename _Return, typename... _Args>
+    class Delegate<_Return(_Args...)>
+    {
+        using Function = std::add_pointer_t<_Return(_Args...)>;
+
+        union Context
+        {
+            void* object;
+            Function function;
+        };
+        using Stub = std::add_pointer_t<_Return(Context context, _Args... args)>;
+
+        template<typename _Callable>
+        static constexpr bool IsFunctionLike = std::is_convertible_v<_Callable, Function>;
+
+        template<typename _Callable>
+        static constexpr bool IsStateful = !IsFunctionLike<_Callable>
+            && !std::is_same_v<std::remove_cvref_t<_Callable>, Delegate>
+            && std::is_invocable_r_v<_Return, _Callable&, _Args...>;
+    public:
+        /**
+         * @brief Constructs empty delegate
+         */
+        constexpr Delegate()
+            : _context{.object = nullptr}
+            , _stub(nullptr)
+        {}
+
+        /**
+         * @brief Constructs empty delegate
+         */
+        constexpr Delegate(std::nullptr_t)
+            : Delegate()
+        {}
+
+        /**
+         * @brief Constructs delegate from function pointer or captureless lambda
+         *
+         * @param [in] function Function
+         */
+        template<typename _Callable>
+            requires IsFunctionLike<_Callable>
+        constexpr Delegate(_Callable function)
+            : _context{.function = static_cast<Function>(function)}
+            , _stub(_context.function != nullptr ? FunctionStub : nullptr)
+        {}
+
+        /**
+         * @brief Constructs delegate from stateful callable (bound by reference)
+         *
+         * @param [in] callable Callable object (must outlive delegate)
+         */
+        template<typename _Callable>
+            requires IsStateful<_Callable>
+        constexpr Delegate(_Callable& callable)
+            : _context{.object = const_cast<void*>(static_cast<const void*>(std::addressof(callable)))}
+            , _stub(CallableStub<_Callable>)
+        {}
+
+        template<typename _Callable>
+            requires (!std::is_lvalue_reference_v<_Callable> && IsStateful<_Callable>)
+        Delegate(_Callable&&) = delete; ///< Temporary stateful callable would dangle
+
+        /**
+         * @brief Binds function known at compile time
+         *
+         * @tparam _Function Function
+         *
+         * @returns Delegate
+         */
+        template<auto _Function>
+        static constexpr Delegate Bind()
+        {
+            return Delegate(Context{.object = nullptr}, StaticStub<_Function>);
+        }
+
+        /**
+         * @brief Binds object and method (or function with object reference as first argument)
+         * known at compile time
+         *
+         * @tparam _Method Method pointer (&Class::Method) or function
+         * @param [in] object Object (must outlive delegate)
+         *
+         * @returns Delegate
+         */
+        template<auto _Method, typename _Object>
+        static constexpr Delegate Bind(_Object& object)
+        {
+            return Delegate(Context{.object = const_cast<void*>(static_cast<const void*>(std::addressof(object)))}, MethodStub<_Method, _Object>);
+        }
+
+        /**
+         * @brief Invoke delegate (must not be empty)
+         *
+         * @param [in] args Arguments
+         *
+         * @returns Callback result
+         */
+        constexpr _Return operator()(_Args... args) const
+        {
+            return _stub(_context, std::forward<_Args>(args)...);
+        }
+
+        /**
+         * @brief Check that delegate is not empty
+         *
+         * @retval true Delegate is bound
+         * @retval false Delegate is empty
+         */
+        constexpr explicit operator bool() const
+        {
+            return _stub != nullptr;
+        }
+
+        /**
+         * @brief Compare with nullptr
+         *
+         * @retval true Delegate is empty
+         * @retval false Delegate is bound
+         */
+        constexpr bool operator==(std::nullptr_t) const
+        {
+            return _stub == nullptr;
+        }
+
+    private:
+        constexpr Delegate(Context context, Stub stub)
+            : _context(context)
+            , _stub(stub)
+        {}
+
+        static constexpr _Return FunctionStub(Context context, _Args... args)
+        {
+            return context.function(std::forward<_Args>(args)...);
+        }
+
+        template<typename _Callable>
+        static constexpr _Return CallableStub(Context context, _Args... args)
+        {
+            return std::invoke(*static_cast<_Callable*>(context.object), std::forward<_Args>(args)...);
+        }
+
+        template<auto _Function>
+        static constexpr _Return StaticStub(Context, _Args... args)
+        {
+            return std::invoke(_Function, std::forward<_Args>(args)...);
+        }
+
+        template<auto _Method, typename _Object>
+        static constexpr _Return MethodStub(Context context, _Args... args)
+        {
+            return std::invoke(_Method, *static_cast<_Object*>(context.object), std::forward<_Args>(args)...);
+        }
+
+        Context _context;
+        Stub _stub;
+    };
+} // namespace Zhele
+
+#endif //! ZHELE_COMMON_DELEGATE_H
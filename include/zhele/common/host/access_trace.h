@@ -0,0 +1,429 @@
+/**
+ * @file
+ * Peripheral access tracer for host (off-target) builds
+ *
+ * @details
+ * Counts bus accesses made by code under test: reads, writes and read-modify-writes
+ * per register and per call site (address of accessing instruction). While recording,
+ * register file windows are protected, so every access raises SIGSEGV. Handler records
+ * access, opens windows and executes faulting instruction in single-step mode (x86 trap flag),
+ * then windows are protected again. So tracer sees all accesses: register wrappers, raw CMSIS
+ * structs and buffers (USB PMA for example). Accesses made by peripheral models are not counted.
+ *
+ * Read-modify-write is either one instruction (or [mem], imm) or write to register
+ * right after reading the same register (ldr/orr/str sequence).
+ *
+ * Call sites can be resolved with addr2line (build tests with -no-pie for stable addresses).
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_COMMON_HOST_ACCESS_TRACE_H
+#define ZHELE_COMMON_HOST_ACCESS_TRACE_H
+
+#if !defined(__i386__) && !defined(__x86_64__)
+    #error "Zhele: access tracer is supported only on x86 hosts"
+#endif
+
+#include "register_file.h"
+
+#include <signal.h>
+#include <ucontext.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+
+namespace Zhele::Host
+{
+    /**
+     * @brief Access kind
+     */
+    enum class AccessKind : uint8_t
+    {
+        Read, ///< Read
+        Write, ///< Write
+        ReadModifyWrite ///< Read and write by single instruction
+    };
+
+    /**
+     * @brief Access counters
+     */
+    struct AccessCounters
+    {
+        uint32_t Reads = 0; ///< Reads count (including read-modify-writes)
+        uint32_t Writes = 0; ///< Writes count (including read-modify-writes)
+        uint32_t ReadModifyWrites = 0; ///< Read-modify-writes count
+
+        /**
+         * @brief Returns total bus accesses count
+         *
+         * @returns Reads + writes
+         */
+        uint32_t Total() const
+        {
+            return Reads + Writes;
+        }
+
+        bool operator==(const AccessCounters&) const = default;
+    };
+
+    /**
+     * @brief Access counters for one address and call site
+     */
+    struct AccessRecord
+    {
+        uintptr_t Address; ///< Accessed address
+        uintptr_t Site; ///< Accessing instruction address
+        AccessCounters Counters; ///< Counters
+    };
+
+    /**
+     * @brief Recorded access (trace event)
+     */
+    struct AccessEvent
+    {
+        uintptr_t Address; ///< Accessed address
+        uintptr_t Site; ///< Accessing instruction address
+        AccessKind Kind; ///< Access kind
+    };
+
+    /**
+     * @brief Peripheral access tracer
+     */
+    class AccessTrace
+    {
+    public:
+        static constexpr unsigned MaxRecords = 256;
+        static constexpr unsigned MaxEvents = 1024;
+
+        /**
+         * @brief Clear counters and start recording
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Start()
+        {
+            Clear();
+
+            struct sigaction action {};
+            action.sa_flags = SA_SIGINFO;
+            sigemptyset(&action.sa_mask);
+
+            action.sa_sigaction = OnFault;
+            sigaction(SIGSEGV, &action, &_oldFaultAction);
+            action.sa_sigaction = OnTrap;
+            sigaction(SIGTRAP, &action, &_oldTrapAction);
+
+            _recording = true;
+            RegisterFile::Protect(true);
+        }
+
+        /**
+         * @brief Stop recording (counters are kept)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Stop()
+        {
+            if(!_recording)
+                return;
+
+            _recording = false;
+            RegisterFile::Protect(false);
+            sigaction(SIGSEGV, &_oldFaultAction, nullptr);
+            sigaction(SIGTRAP, &_oldTrapAction, nullptr);
+        }
+
+        /**
+         * @brief Clear counters and trace
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Clear()
+        {
+            _recordCount = 0;
+            _eventCount = 0;
+            _dropped = 0;
+            _lastEvent = {};
+        }
+
+        /**
+         * @brief Returns counters for address range (all call sites)
+         *
+         * @param [in] address Range base (register address)
+         * @param [in] size Range size
+         *
+         * @returns Accumulated counters
+         */
+        static AccessCounters Count(uintptr_t address, size_t size = sizeof(uint32_t))
+        {
+            AccessCounters result;
+            for(unsigned i = 0; i < _recordCount; ++i)
+            {
+                if(_records[i].Address - address < size)
+                {
+                    result.Reads += _records[i].Counters.Reads;
+                    result.Writes += _records[i].Counters.Writes;
+                    result.ReadModifyWrites += _records[i].Counters.ReadModifyWrites;
+                }
+            }
+            return result;
+        }
+
+        /**
+         * @brief Returns counters for register
+         *
+         * @param [in] reg Register (USART1->SR, GPIOA->BSRR...)
+         *
+         * @returns Accumulated counters
+         */
+        template<typename _Register>
+        static AccessCounters Count(const volatile _Register& reg)
+        {
+            return Count(reinterpret_cast<uintptr_t>(&reg), sizeof(_Register));
+        }
+
+        /**
+         * @brief Returns counters for all addresses
+         *
+         * @returns Accumulated counters
+         */
+        static AccessCounters Total()
+        {
+            return Count(0, SIZE_MAX);
+        }
+
+        /**
+         * @brief Returns per register and per call site counters
+         *
+         * @returns Records
+         */
+        static std::span<const AccessRecord> Records()
+        {
+            return {_records.data(), _recordCount};
+        }
+
+        /**
+         * @brief Returns recorded accesses in order
+         *
+         * @returns Events (first MaxEvents accesses)
+         */
+        static std::span<const AccessEvent> Events()
+        {
+            return {_events.data(), _eventCount};
+        }
+
+        /**
+         * @brief Returns count of accesses not recorded because of records limit
+         *
+         * @returns Dropped accesses count
+         */
+        static unsigned Dropped()
+        {
+            return _dropped;
+        }
+
+        /**
+         * @brief Print per register and per call site counters
+         *
+         * @param [in] stream Output stream
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Print(std::FILE* stream = stdout)
+        {
+            std::fprintf(stream, "%-12s %-18s %8s %8s %8s\n", "address", "site", "reads", "writes", "rmw");
+            for(const auto& record : Records())
+            {
+                std::fprintf(stream, "0x%08jx 0x%016jx %8u %8u %8u\n",
+                    static_cast<uintmax_t>(record.Address), static_cast<uintmax_t>(record.Site),
+                    record.Counters.Reads, record.Counters.Writes, record.Counters.ReadModifyWrites);
+            }
+            if(_dropped != 0)
+                std::fprintf(stream, "%u accesses dropped\n", _dropped);
+        }
+
+    private:
+        static constexpr unsigned long TrapFlag = 0x100;
+        static constexpr unsigned long PageFaultWrite = 0x02;
+
+    #if defined(__x86_64__)
+        static constexpr int InstructionPointer = REG_RIP;
+    #else
+        static constexpr int InstructionPointer = REG_EIP;
+    #endif
+
+        /**
+         * @brief Check that instruction reads and writes memory operand
+         *
+         * @param [in] code Instruction
+         *
+         * @retval true Instruction is read-modify-write (add/or/and/xor/inc/shl/bts... with memory destination)
+         * @retval false Instruction only reads or only writes memory
+         */
+        static bool IsReadModifyWrite(const uint8_t* code)
+        {
+            // Legacy prefixes
+            while(*code == 0x66 || *code == 0x67 || *code == 0xf0 || *code == 0xf2 || *code == 0xf3
+                || *code == 0x26 || *code == 0x2e || *code == 0x36 || *code == 0x3e || *code == 0x64 || *code == 0x65)
+            {
+                ++code;
+            }
+        #if defined(__x86_64__)
+            // REX
+            if((*code & 0xf0) == 0x40)
+                ++code;
+        #endif
+            uint8_t opcode = code[0];
+            uint8_t reg = (code[1] >> 3) & 0x07;
+
+            // add/or/adc/sbb/and/sub/xor r/m, reg (cmp only reads)
+            if(opcode < 0x40 && (opcode & 0x07) < 2)
+                return (opcode & 0x38) != 0x38;
+
+            switch(opcode)
+            {
+            case 0x80: case 0x81: case 0x83:
+                return reg != 7;
+            case 0x86: case 0x87:
+            case 0xc0: case 0xc1: case 0xd0: case 0xd1: case 0xd2: case 0xd3:
+                return true;
+            case 0xf6: case 0xf7:
+                return reg == 2 || reg == 3;
+            case 0xfe: case 0xff:
+                return reg < 2;
+            case 0x0f:
+                switch(code[1])
+                {
+                case 0xab: case 0xb3: case 0xbb: case 0xb0: case 0xb1: case 0xc0: case 0xc1:
+                    return true;
+                case 0xba:
+                    return ((code[2] >> 3) & 0x07) >= 5;
+                }
+                return false;
+            }
+            return false;
+        }
+
+        static AccessRecord* FindRecord(uintptr_t address, uintptr_t site)
+        {
+            for(unsigned i = 0; i < _recordCount; ++i)
+            {
+                if(_records[i].Address == address && _records[i].Site == site)
+                    return &_records[i];
+            }
+            if(_recordCount == MaxRecords)
+                return nullptr;
+
+            _records[_recordCount] = {address, site, {}};
+            return &_records[_recordCount++];
+        }
+
+        static void Record(uintptr_t address, uintptr_t site, AccessKind kind)
+        {
+            AccessRecord* record = FindRecord(address, site);
+            if(record == nullptr)
+            {
+                ++_dropped;
+                return;
+            }
+
+            if(kind != AccessKind::Write)
+                ++record->Counters.Reads;
+            if(kind != AccessKind::Read)
+                ++record->Counters.Writes;
+            if(kind == AccessKind::ReadModifyWrite
+                || (kind == AccessKind::Write && _lastEvent.Kind == AccessKind::Read && _lastEvent.Address == address))
+            {
+                ++record->Counters.ReadModifyWrites;
+            }
+
+            _lastEvent = {address, site, kind};
+            if(_eventCount < MaxEvents)
+                _events[_eventCount++] = _lastEvent;
+        }
+
+        static void OnFault(int, siginfo_t* info, void* context)
+        {
+            auto& registers = static_cast<ucontext_t*>(context)->uc_mcontext.gregs;
+            uintptr_t address = reinterpret_cast<uintptr_t>(info->si_addr);
+
+            if(!_recording || !RegisterFile::Contains(address))
+            {
+                // Real fault: restore default action, faulting instruction will be restarted
+                signal(SIGSEGV, SIG_DFL);
+                return;
+            }
+
+            if(!RegisterFile::Stepping())
+            {
+                uintptr_t site = static_cast<uintptr_t>(registers[InstructionPointer]);
+                AccessKind kind = IsReadModifyWrite(reinterpret_cast<const uint8_t*>(site))
+                    ? AccessKind::ReadModifyWrite
+                    : (registers[REG_ERR] & PageFaultWrite) ? AccessKind::Write : AccessKind::Read;
+                Record(address, site, kind);
+            }
+
+            RegisterFile::Protect(false);
+            registers[REG_EFL] |= TrapFlag;
+        }
+
+        static void OnTrap(int, siginfo_t*, void* context)
+        {
+            auto& registers = static_cast<ucontext_t*>(context)->uc_mcontext.gregs;
+            registers[REG_EFL] &= ~TrapFlag;
+            if(_recording)
+                RegisterFile::Protect(true);
+        }
+
+        static inline std::array<AccessRecord, MaxRecords> _records{};
+        static inline unsigned _recordCount = 0;
+        static inline std::array<AccessEvent, MaxEvents> _events{};
+        static inline unsigned _eventCount = 0;
+        static inline unsigned _dropped = 0;
+        static inline AccessEvent _lastEvent{};
+
+        static inline volatile bool _recording = false;
+        static inline struct sigaction _oldFaultAction{};
+        static inline struct sigaction _oldTrapAction{};
+    };
+
+    /**
+     * @brief Records accesses in scope
+     *
+     * @par Example
+     * @code
+     * {
+     *     Host::ScopedAccessTrace trace;
+     *     Usart1::Write('A');
+     * }
+     * assert(Host::AccessTrace::Count(USART1->SR).Reads == 1);
+     * @endcode
+     */
+    class ScopedAccessTrace
+    {
+    public:
+        ScopedAccessTrace()
+        {
+            AccessTrace::Start();
+        }
+
+        ~ScopedAccessTrace()
+        {
+            AccessTrace::Stop();
+        }
+
+        ScopedAccessTrace(const ScopedAccessTrace&) = delete;
+        ScopedAccessTrace& operator=(const ScopedAccessTrace&) = delete;
+    };
+} // namespace Zhele::Host
+
+#endif //! ZHELE_COMMON_HOST_ACCESS_TRACE_H
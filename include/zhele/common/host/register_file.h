@@ -0,0 +1,450 @@
+/**
+ * @file
+ * Simulated register file for host (off-target) builds
+ *
+ * @details
+ * Enabled by ZHELE_HOST_REGISTERS. Peripheral address windows are mapped into host
+ * process at the same addresses as on MCU, so CMSIS structs (USART1, DMA1_Channel1, NVIC...)
+ * are dereferenced as is. Register wrappers from ioreg.h notify register file about
+ * every access (Touch), register file steps peripheral models attached to touched address
+ * range, so polling loops (while(!(SR & TXE))) make progress.
+ *
+ * Host build must have the same pointer width as target (-m32), because DMA code
+ * stores buffer addresses in 32-bit registers.
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_COMMON_HOST_REGISTER_FILE_H
+#define ZHELE_COMMON_HOST_REGISTER_FILE_H
+
+#if !defined(__linux__)
+    #error "Zhele: host register file is supported only on Linux hosts"
+#endif
+
+#include <sys/mman.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Zhele::Host
+{
+    /**
+     * @brief Base class for peripheral model
+     *
+     * @details
+     * Model emulates hardware side of peripheral: sets status flags, moves data, raises "interrupts".
+     */
+    class PeripheralModel
+    {
+    public:
+        virtual ~PeripheralModel() = default;
+
+        /**
+         * @brief Apply reset state (called after attaching and on RegisterFile::Reset)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        virtual void Reset() {}
+
+        /**
+         * @brief Advance model (called on each access to attached address range)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        virtual void Step() {}
+    };
+
+    /**
+     * @brief Simulated register file
+     */
+    class RegisterFile
+    {
+        struct Window
+        {
+            uintptr_t base;
+            size_t size;
+        };
+
+        struct Binding
+        {
+            uintptr_t base;
+            size_t size;
+            PeripheralModel* model;
+        };
+    public:
+        using InterruptHandler = std::add_pointer_t<void()>;
+        using WaitHandler = std::add_pointer_t<bool()>;
+
+        static constexpr unsigned MaxWindows = 8;
+        static constexpr unsigned MaxModels = 32;
+        static constexpr unsigned MaxPendingInterrupts = 8;
+
+        /**
+         * @brief Map zero-filled address window at fixed address
+         *
+         * @param [in] base Window base address (MCU address)
+         * @param [in] size Window size
+         *
+         * @retval true Window is mapped (or was already mapped)
+         * @retval false Mapping failed (address is busy or windows limit is reached)
+         */
+        static bool Map(uintptr_t base, size_t size)
+        {
+            for(unsigned i = 0; i < _windowCount; ++i)
+            {
+                if(_windows[i].base == base)
+                    return _windows[i].size >= size;
+            }
+
+            if(_windowCount == MaxWindows)
+                return false;
+
+            void* address = mmap(reinterpret_cast<void*>(base), size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+            if(address != reinterpret_cast<void*>(base))
+            {
+                if(address != MAP_FAILED)
+                    munmap(address, size);
+                return false;
+            }
+
+            _windows[_windowCount++] = {base, size};
+            return true;
+        }
+
+        /**
+         * @brief Check that address belongs to mapped window
+         *
+         * @param [in] address Address
+         *
+         * @retval true Address is mapped
+         * @retval false Address is not mapped
+         */
+        static bool Contains(uintptr_t address)
+        {
+            for(unsigned i = 0; i < _windowCount; ++i)
+            {
+                if(address - _windows[i].base < _windows[i].size)
+                    return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Change access protection of all windows
+         *
+         * @details
+         * Used by access tracer: protected window raises SIGSEGV on every access.
+         *
+         * @param [in] enable True - forbid any access, false - allow read and write
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Protect(bool enable)
+        {
+            for(unsigned i = 0; i < _windowCount; ++i)
+                mprotect(reinterpret_cast<void*>(_windows[i].base), _windows[i].size, enable ? PROT_NONE : PROT_READ | PROT_WRITE);
+        }
+
+        /**
+         * @brief Zero all windows and reset attached models
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Reset()
+        {
+            for(unsigned i = 0; i < _windowCount; ++i)
+                std::memset(reinterpret_cast<void*>(_windows[i].base), 0, _windows[i].size);
+
+            for(unsigned i = 0; i < _modelCount; ++i)
+                _models[i].model->Reset();
+            _pendingCount = 0;
+        }
+
+        /**
+         * @brief Attach peripheral model to address range
+         *
+         * @param [in] model Model
+         * @param [in] base Range base address
+         * @param [in] size Range size
+         *
+         * @retval true Model attached
+         * @retval false Models limit is reached
+         */
+        static bool Attach(PeripheralModel& model, uintptr_t base, size_t size)
+        {
+            if(_modelCount == MaxModels)
+                return false;
+
+            _models[_modelCount++] = {base, size, &model};
+            model.Reset();
+            return true;
+        }
+
+        /**
+         * @brief Detach peripheral model
+         *
+         * @param [in] model Model
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Detach(PeripheralModel& model)
+        {
+            unsigned target = 0;
+            for(unsigned i = 0; i < _modelCount; ++i)
+            {
+                if(_models[i].model != &model)
+                    _models[target++] = _models[i];
+            }
+            _modelCount = target;
+        }
+
+        /**
+         * @brief Notify register file about access to address range
+         *
+         * @param [in] address Accessed address
+         * @param [in] size Accessed range size (register or whole peripheral struct)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Touch(uintptr_t address, size_t size = 1)
+        {
+            if(_stepping)
+                return;
+
+            _stepping = true;
+            for(unsigned i = 0; i < _modelCount; ++i)
+            {
+                if(address < _models[i].base + _models[i].size && _models[i].base < address + size)
+                    _models[i].model->Step();
+            }
+            _stepping = false;
+
+            DispatchInterrupts();
+        }
+
+        /**
+         * @brief Step all attached models
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Step()
+        {
+            if(_stepping)
+                return;
+
+            _stepping = true;
+            for(unsigned i = 0; i < _modelCount; ++i)
+                _models[i].model->Step();
+            _stepping = false;
+
+            DispatchInterrupts();
+        }
+
+        /**
+         * @brief Request interrupt from model
+         *
+         * @details
+         * Unlike handler called by model directly, raised handler runs after stepping
+         * (before access that caused stepping), so its register accesses step models
+         * and are seen by access tracer as code under test. Handlers are not nested:
+         * interrupt raised while handler runs is called after it returns.
+         *
+         * @param [in] handler Interrupt handler
+         *
+         * @retval true Interrupt is pending
+         * @retval false Pending interrupts limit is reached
+         */
+        static bool Raise(InterruptHandler handler)
+        {
+            for(unsigned i = 0; i < _pendingCount; ++i)
+            {
+                if(_pending[i] == handler)
+                    return true;
+            }
+
+            if(_pendingCount == MaxPendingInterrupts)
+                return false;
+
+            _pending[_pendingCount++] = handler;
+            return true;
+        }
+
+        /**
+         * @brief Set handler that advances simulated time while core waits for interrupt
+         *
+         * @details
+         * Handler is called by \ref WaitForInterrupt until some interrupt is dispatched.
+         * It usually advances timer model to its next event.
+         *
+         * @param [in] handler Wait handler (returns false if no event can wake core up), nullptr to remove
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void SetWaitHandler(WaitHandler handler)
+        {
+            _waitHandler = handler;
+        }
+
+        /**
+         * @brief Emulate WFI instruction
+         *
+         * @details
+         * Without wait handler models are stepped once (WFI may return without interrupt on MCU too).
+         * Interrupt handlers are dispatched inside wait, before code after WFI runs.
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void WaitForInterrupt()
+        {
+            if(_waitHandler == nullptr)
+            {
+                Step();
+                return;
+            }
+
+            uint32_t dispatched = _dispatched;
+            while(_dispatched == dispatched && _waitHandler())
+                ;
+        }
+
+        /**
+         * @brief Check that models are stepping now (accesses are made by models, not by code under test)
+         *
+         * @retval true Models are stepping
+         * @retval false Models are not stepping
+         */
+        static bool Stepping()
+        {
+            return _stepping;
+        }
+
+    private:
+        static void DispatchInterrupts()
+        {
+            if(_dispatching)
+                return;
+
+            _dispatching = true;
+            while(_pendingCount > 0)
+            {
+                InterruptHandler handler = _pending[0];
+                for(unsigned i = 1; i < _pendingCount; ++i)
+                    _pending[i - 1] = _pending[i];
+                --_pendingCount;
+
+                ++_dispatched;
+                handler();
+            }
+            _dispatching = false;
+        }
+
+        static inline std::array<Window, MaxWindows> _windows{};
+        static inline unsigned _windowCount = 0;
+
+        static inline std::array<Binding, MaxModels> _models{};
+        static inline unsigned _modelCount = 0;
+
+        static inline bool _stepping = false;
+
+        static inline std::array<InterruptHandler, MaxPendingInterrupts> _pending{};
+        static inline unsigned _pendingCount = 0;
+        static inline bool _dispatching = false;
+        static inline uint32_t _dispatched = 0;
+
+        static inline WaitHandler _waitHandler = nullptr;
+    };
+
+    /**
+     * @brief Converts register address (integer or pointer) to uintptr_t
+     *
+     * @param [in] address Address
+     *
+     * @returns Address as integer
+     */
+    template<typename _Address>
+    uintptr_t AddressOf(_Address address)
+    {
+        if constexpr (std::is_pointer_v<_Address>)
+            return reinterpret_cast<uintptr_t>(address);
+        else
+            return static_cast<uintptr_t>(address);
+    }
+
+    /**
+     * @brief Register reference for models
+     *
+     * @tparam _DataType Register data type
+     *
+     * @param [in] address Register address
+     *
+     * @returns Reference to simulated register
+     */
+    template<typename _DataType = uint32_t>
+    volatile _DataType& Register(uintptr_t address)
+    {
+        return *reinterpret_cast<volatile _DataType*>(address);
+    }
+
+    /**
+     * @brief Model that holds some bits of register set (or cleared)
+     *
+     * @details
+     * Useful for status registers of polled peripherals (TXE, RXNE, READY flags).
+     */
+    class FlagModel : public PeripheralModel
+    {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * @param [in] address Register address
+         * @param [in] setMask Bits to hold set
+         * @param [in] clearMask Bits to hold cleared
+         */
+        FlagModel(uintptr_t address, uint32_t setMask, uint32_t clearMask = 0)
+            : _address(address)
+            , _setMask(setMask)
+            , _clearMask(clearMask)
+        {
+            RegisterFile::Attach(*this, address, sizeof(uint32_t));
+        }
+
+        ~FlagModel() override
+        {
+            RegisterFile::Detach(*this);
+        }
+
+        void Reset() override
+        {
+            Step();
+        }
+
+        void Step() override
+        {
+            Register(_address) = (Register(_address) & ~_clearMask) | _setMask;
+        }
+
+    private:
+        uintptr_t _address;
+        uint32_t _setMask;
+        uint32_t _clearMask;
+    };
+} // namespace Zhele::Host
+
+#endif //! ZHELE_COMMON_HOST_REGISTER_FILE_H
@@ -30,6 +30,16 @@ namespace Zhele::IO {
     });
   }
 
+  template<typename... _Pins>
+  void PinList<_Pins...>::WriteByTable(typename PinList<_Pins...>::DataType value)
+  requires (sizeof...(_Pins) <= PinList<_Pins...>::MaxLookupTableWidth) {
+    _ports.foreach([value](auto port) {
+      using Port = typename decltype(port)::type;
+      // Bits above pin list width are ignored (as by Write)
+      port.ClearAndSet(GetPinlistMaskForPort(port), LookupTable<Port>[value & ((1u << sizeof...(_Pins)) - 1)]);
+    });
+  }
+
   template<typename... _Pins>
   typename PinList<_Pins...>::DataType PinList<_Pins...>::Read() {
     auto result = DataType{};
@@ -198,15 +208,68 @@ namespace Zhele::IO {
   }
 
   template<typename... _Pins>
-  constexpr auto PinList<_Pins...>::GetPinlistValueForPort(auto port, typename PinList<_Pins...>::DataType value) {
-    auto result = typename template_utils::type_unbox<port>::DataType{};
-    GetPinsForPort(port).foreach([value, &result](auto pin) {
-      if (value & (1 << _pins.search(pin)))
-        result |= (1 << pin.Number);
+  template<typename Port>
+  consteval auto PinList<_Pins...>::GetRunsForPort(template_utils::type_box<Port> port) {
+    struct {
+      std::array<PinRun, decltype(GetPinsForPort(port))::size()> Runs{};
+      unsigned Count = 0;
+    } result;
+    GetPinsForPort(port).foreach([&result](auto pin) {
+      const unsigned index = _pins.search(pin);
+      const unsigned bit = pin.Number;
+      if (result.Count > 0) {
+        auto& last = result.Runs[result.Count - 1];
+        if (last.Index + last.Length == index && last.Bit + last.Length == bit) {
+          ++last.Length;
+          return;
+        }
+      }
+      result.Runs[result.Count++] = {index, bit, 1};
     });
     return result;
   }
 
+  template<typename... _Pins>
+  template<typename Port, unsigned run>
+  constexpr typename PinList<_Pins...>::WordType PinList<_Pins...>::MoveRunToPort(typename PinList<_Pins...>::DataType value) {
+    constexpr PinRun pins = PortRuns<Port>.Runs[run];
+    constexpr WordType mask = WordType(~WordType{}) >> (std::numeric_limits<WordType>::digits - pins.Length);
+    return ((WordType(value) >> pins.Index) & mask) << pins.Bit;
+  }
+
+  template<typename... _Pins>
+  template<typename Port, unsigned run>
+  constexpr typename PinList<_Pins...>::DataType PinList<_Pins...>::MoveRunToList(typename PinList<_Pins...>::WordType portValue) {
+    constexpr PinRun pins = PortRuns<Port>.Runs[run];
+    constexpr WordType mask = WordType(~WordType{}) >> (std::numeric_limits<WordType>::digits - pins.Length);
+    return static_cast<DataType>(((portValue >> pins.Bit) & mask) << pins.Index);
+  }
+
+  template<typename... _Pins>
+  template<typename Port>
+  consteval auto PinList<_Pins...>::MakeLookupTable(template_utils::type_box<Port> port) {
+    std::array<typename Port::DataType, (1u << sizeof...(_Pins))> table{};
+    for (unsigned value = 0; value < table.size(); ++value)
+      table[value] = GetPinlistValueForPort(port, static_cast<DataType>(value));
+    return table;
+  }
+
+  template<typename... _Pins>
+  constexpr auto PinList<_Pins...>::GetPinlistValueForPort(auto port, typename PinList<_Pins...>::DataType value) {
+    using Port = typename decltype(port)::type;
+    return [value]<unsigned... runs>(std::integer_sequence<unsigned, runs...>) {
+      return static_cast<typename Port::DataType>((MoveRunToPort<Port, runs>(value) | ... | WordType{}));
+    }(std::make_integer_sequence<unsigned, PortRuns<Port>.Count>{});
+  }
+
+  template<typename... _Pins>
+  constexpr typename PinList<_Pins...>::DataType PinList<_Pins...>::GetPinlistValueFromPort(auto port, typename PinList<_Pins...>::WordType portValue) {
+    using Port = typename decltype(port)::type;
+    return [portValue]<unsigned... runs>(std::integer_sequence<unsigned, runs...>) {
+      return static_cast<DataType>((MoveRunToList<Port, runs>(portValue) | ... | DataType{}));
+    }(std::make_integer_sequence<unsigned, PortRuns<Port>.Count>{});
+  }
+
   template<typename... _Pins>
   consteval auto PinList<_Pins...>::GetPinlistMaskForPort(auto port) {
     auto mask = typename template_utils::type_unbox<port>::DataType{};
@@ -226,26 +289,12 @@ namespace Zhele::IO {
 
   template<typename... _Pins>
   typename PinList<_Pins...>::DataType PinList<_Pins...>::ExtractPinlistOutValueFromPort(auto port) {
-    auto result = DataType{};
-    auto portReadValue = template_utils::type_unbox<port>::Read();
-    GetPinsForPort(port).foreach([&result, portReadValue](auto pin) {
-      result |= ((portReadValue & (1 << pin.Number)) != 0)
-        ? (1 << _pins.search(pin))
-        : 0;
-    });
-    return result;
+    return GetPinlistValueFromPort(port, template_utils::type_unbox<port>::Read());
   }
 
   template<typename... _Pins>
   typename PinList<_Pins...>::DataType PinList<_Pins...>::ExtractPinlistValueFromPort(auto port) {
-    auto result = DataType{};
-    auto portReadValue = template_utils::type_unbox<port>::PinRead();
-    GetPinsForPort(port).foreach([&result, portReadValue](auto pin) {
-      result |= ((portReadValue & (1 << pin.Number)) != 0)
-        ? (1 << _pins.search(pin))
-        : 0;
-    });
-    return result;
+    return GetPinlistValueFromPort(port, template_utils::type_unbox<port>::PinRead());
   }
 
 } // namespace Zhele::IO
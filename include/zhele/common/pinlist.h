@@ -13,8 +13,10 @@
 #include "template_utils/data_type_selector.h"
 #include "traits/ioport_capabilities.h"
 
+#include <array>
 #include <limits>
 #include <type_traits>
+#include <utility>
 
 namespace Zhele::IO {
   /**
@@ -43,6 +45,20 @@ namespace Zhele::IO {
     template<DataType value>
     static void Write();
 
+    /// Maximum pin list width for \ref WriteByTable (lookup table has 2^width entries per port)
+    static constexpr unsigned MaxLookupTableWidth = 8;
+
+    /**
+     * @brief Writes value using precomputed per-port lookup tables
+     *
+     * @details
+     * Scattered pins cost one table load and one BSRR store per port.
+     * Tables (2^width port values per port) are placed in flash only if this method is used.
+     * Value bits above pin list width are ignored.
+     */
+    static void WriteByTable(DataType value)
+    requires (sizeof...(_Pins) <= MaxLookupTableWidth);
+
     static DataType Read();
 
     static void Clear(DataType value);
@@ -107,8 +123,38 @@ namespace Zhele::IO {
     using Pin = template_utils::type_unbox<_pins.template get<Index>()>;
 
   private:
+    /// Pins with consecutive numbers both in list and in port (moved by one shift and mask)
+    struct PinRun {
+      unsigned Index;
+      unsigned Bit;
+      unsigned Length;
+    };
+
+    /// Widest of DataType and unsigned (run shifts are made in it)
+    using WordType = std::conditional_t<(sizeof(DataType) > sizeof(unsigned)), DataType, unsigned>;
+
+    template<typename Port>
+    static consteval auto GetRunsForPort(template_utils::type_box<Port> port);
+
+    template<typename Port>
+    static constexpr auto PortRuns = GetRunsForPort(template_utils::type_box<Port>{});
+
+    template<typename Port, unsigned run>
+    static constexpr WordType MoveRunToPort(DataType value);
+
+    template<typename Port, unsigned run>
+    static constexpr DataType MoveRunToList(WordType portValue);
+
+    template<typename Port>
+    static consteval auto MakeLookupTable(template_utils::type_box<Port> port);
+
+    template<typename Port>
+    static constexpr auto LookupTable = MakeLookupTable(template_utils::type_box<Port>{});
+
     static constexpr auto GetPinlistValueForPort(auto port, DataType value);
 
+    static constexpr DataType GetPinlistValueFromPort(auto port, WordType portValue);
+
     static consteval  auto GetPinlistMaskForPort(auto port);
 
     template<typename Port>
@@ -0,0 +1,192 @@
+/**
+ * @file
+ * SPSC ring buffer methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_SPSC_RINGBUFFER_IMPL_H
+#define ZHELE_SPSC_RINGBUFFER_IMPL_H
+
+#include <algorithm>
+#include <cstring>
+
+namespace Zhele::Containers
+{
+    #define SPSC_RINGBUFFER_TEMPLATE_ARGS template<unsigned _Size, typename _DataType>
+    #define SPSC_RINGBUFFER_TEMPLATE_QUALIFIER SpscRingBuffer<_Size, _DataType>
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::SpscRingBuffer() : _write(0), _read(0)
+    {
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    constexpr typename SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::size_type SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::capacity()
+    {
+        return _Size;
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    typename SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::size_type SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::size() const
+    {
+        return Distance(_write.load(std::memory_order_acquire), _read.load(std::memory_order_acquire));
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    typename SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::size_type SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::free_space() const
+    {
+        return _Size - size();
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    bool SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::empty() const
+    {
+        return _write.load(std::memory_order_acquire) == _read.load(std::memory_order_acquire);
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    bool SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::full() const
+    {
+        return size() == _Size;
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    _DataType& SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::front()
+    {
+        return _data[Offset(_read.load(std::memory_order_relaxed))];
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    const _DataType& SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::front() const
+    {
+        return _data[Offset(_read.load(std::memory_order_relaxed))];
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    bool SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::push_back(const _DataType& value)
+    {
+        index_type write = _write.load(std::memory_order_relaxed);
+        if(Distance(write, _read.load(std::memory_order_acquire)) == _Size)
+            return false;
+
+        _data[Offset(write)] = value;
+        _write.store(Advance(write, 1), std::memory_order_release);
+        return true;
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    bool SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::pop_front()
+    {
+        index_type read = _read.load(std::memory_order_relaxed);
+        if(read == _write.load(std::memory_order_acquire))
+            return false;
+
+        _read.store(Advance(read, 1), std::memory_order_release);
+        return true;
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    typename SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::size_type SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::push(std::span<const _DataType> values)
+    {
+        index_type write = _write.load(std::memory_order_relaxed);
+        size_type count = std::min<size_t>(values.size(), _Size - Distance(write, _read.load(std::memory_order_acquire)));
+
+        size_type offset = Offset(write);
+        size_type first = std::min<size_type>(count, _Size - offset);
+        std::memcpy(&_data[offset], values.data(), first * sizeof(_DataType));
+        std::memcpy(&_data[0], values.data() + first, (count - first) * sizeof(_DataType));
+
+        _write.store(Advance(write, count), std::memory_order_release);
+        return count;
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    typename SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::size_type SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::pop(std::span<_DataType> destination)
+    {
+        index_type read = _read.load(std::memory_order_relaxed);
+        size_type count = std::min<size_t>(destination.size(), Distance(_write.load(std::memory_order_acquire), read));
+
+        size_type offset = Offset(read);
+        size_type first = std::min<size_type>(count, _Size - offset);
+        std::memcpy(destination.data(), &_data[offset], first * sizeof(_DataType));
+        std::memcpy(destination.data() + first, &_data[0], (count - first) * sizeof(_DataType));
+
+        _read.store(Advance(read, count), std::memory_order_release);
+        return count;
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    std::span<_DataType> SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::write_region()
+    {
+        index_type write = _write.load(std::memory_order_relaxed);
+        size_type free = _Size - Distance(write, _read.load(std::memory_order_acquire));
+        size_type offset = Offset(write);
+
+        return {&_data[offset], std::min<size_type>(free, _Size - offset)};
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    void SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::commit(size_type count)
+    {
+        _write.store(Advance(_write.load(std::memory_order_relaxed), count), std::memory_order_release);
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    std::span<_DataType> SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::read_region()
+    {
+        index_type read = _read.load(std::memory_order_relaxed);
+        size_type used = Distance(_write.load(std::memory_order_acquire), read);
+        size_type offset = Offset(read);
+
+        return {&_data[offset], std::min<size_type>(used, _Size - offset)};
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    void SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::consume(size_type count)
+    {
+        _read.store(Advance(_read.load(std::memory_order_relaxed), count), std::memory_order_release);
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    void SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::clear()
+    {
+        _read.store(0, std::memory_order_relaxed);
+        _write.store(0, std::memory_order_release);
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    _DataType& SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::operator[](size_type index)
+    {
+        return _data[Offset(Advance(_read.load(std::memory_order_relaxed), index))];
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    const _DataType& SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::operator[](size_type index) const
+    {
+        return _data[Offset(Advance(_read.load(std::memory_order_relaxed), index))];
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    typename SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::index_type SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::Advance(index_type index, size_type count)
+    {
+        unsigned result = unsigned(index) + count;
+        return result >= 2 * _Size ? result - 2 * _Size : result;
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    typename SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::size_type SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::Offset(index_type index)
+    {
+        return index >= _Size ? index - _Size : index;
+    }
+
+    SPSC_RINGBUFFER_TEMPLATE_ARGS
+    typename SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::size_type SPSC_RINGBUFFER_TEMPLATE_QUALIFIER::Distance(index_type write, index_type read)
+    {
+        return write >= read ? write - read : 2 * _Size - (read - write);
+    }
+} // namespace Zhele::Containers
+
+#endif //! ZHELE_SPSC_RINGBUFFER_IMPL_H
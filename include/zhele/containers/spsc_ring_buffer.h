@@ -0,0 +1,224 @@
+/**
+ * @file
+ * Implements single-producer/single-consumer ring buffer with bulk operations
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_SPSC_RINGBUFFER_H
+#define ZHELE_SPSC_RINGBUFFER_H
+
+#include "../common/template_utils/data_type_selector.h"
+
+#include <atomic>
+#include <span>
+#include <type_traits>
+
+namespace Zhele::Containers
+{
+    /**
+     * @brief Implements lock-free single-producer/single-consumer ring buffer
+     *
+     * @details
+     * Producer (for example, DMA or USB interrupt) changes only write index, consumer changes
+     * only read index, so buffer doesn't need critical sections or atomic read-modify-write
+     * (works on Cortex-M0 too). Besides per-element API there are bulk operations:
+     * push/pop copy span of elements, write_region/commit and read_region/consume expose
+     * contiguous free (used) block, so DMA or PMA copy can work with buffer memory directly.
+     *
+     * @tparam _Size Size (any, not only power of 2)
+     * @tparam _DataType Data type
+     */
+    template<unsigned _Size, typename _DataType = uint8_t>
+    class SpscRingBuffer
+    {
+        static_assert(_Size > 0);
+        static_assert(std::is_trivially_copyable_v<_DataType>, "SpscRingBuffer elements are copied with memcpy (DMA)");
+
+        // Indexes run in [0, 2 * _Size), so full and empty states differ without extra counter
+        using index_type = typename Zhele::template_utils::SuitableUnsignedTypeForLength<2 * _Size>::type;
+        using Atomic = std::atomic<index_type>;
+    public:
+        using size_type = typename Zhele::template_utils::SuitableUnsignedTypeForLength<_Size>::type;
+        using value_type = _DataType;
+        using reference = _DataType&;
+        using const_reference = const _DataType&;
+
+        /**
+         * @brief Constructor
+         *
+         * @par Returns
+         *  Nothing
+         */
+        SpscRingBuffer();
+
+        /**
+         * @brief Returns capacity
+         *
+         * @returns Buffer capacity
+         */
+        static constexpr size_type capacity();
+
+        /**
+         * @brief Returns count of elements in the buffer
+         *
+         * @returns Count of elements
+         */
+        size_type size() const;
+
+        /**
+         * @brief Returns count of free elements
+         *
+         * @returns Free space
+         */
+        size_type free_space() const;
+
+        /**
+         * @brief Check for emptiness
+         *
+         * @retval true Buffer is empty
+         * @retval false Buffer is not empty
+         */
+        bool empty() const;
+
+        /**
+         * @brief Check for fullnes
+         *
+         * @retval true Buffer is full
+         * @retval false Buffer is not full
+         */
+        bool full() const;
+
+        /**
+         * @brief Find out the value of the first element (consumer)
+         *
+         * @returns Reference to element
+         */
+        reference front();
+
+        /**
+         * @brief Find out the value of the first element (consumer)
+         *
+         * @returns Const reference to element
+         */
+        const_reference front() const;
+
+        /**
+         * @brief Add an item to the end (producer)
+         *
+         * @param [in] value Value
+         *
+         * @retval false Buffer is full
+         * @retval true Item was added
+         */
+        bool push_back(const _DataType& value);
+
+        /**
+         * @brief Retrieves the first element (consumer)
+         *
+         * @retval false If is empty
+         * @retval true If isn't empty
+         */
+        bool pop_front();
+
+        /**
+         * @brief Add items to the end (producer)
+         *
+         * @param [in] values Items
+         *
+         * @returns Count of added items (less than values size if there is no enough space)
+         */
+        size_type push(std::span<const _DataType> values);
+
+        /**
+         * @brief Retrieves items from the beginning (consumer)
+         *
+         * @param [out] destination Destination
+         *
+         * @returns Count of retrieved items (less than destination size if there is no enough items)
+         */
+        size_type pop(std::span<_DataType> destination);
+
+        /**
+         * @brief Returns largest contiguous free block (producer)
+         *
+         * @details
+         * Fill returned block and call commit.
+         *
+         * @returns Free block (empty if buffer is full)
+         */
+        std::span<_DataType> write_region();
+
+        /**
+         * @brief Publish elements written to write region (producer)
+         *
+         * @param [in] count Count of written elements (not greater than write region size)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        void commit(size_type count);
+
+        /**
+         * @brief Returns largest contiguous used block (consumer)
+         *
+         * @details
+         * Process returned block and call consume.
+         *
+         * @returns Used block (empty if buffer is empty)
+         */
+        std::span<_DataType> read_region();
+
+        /**
+         * @brief Release elements from the beginning (consumer)
+         *
+         * @param [in] count Count of elements (not greater than size)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        void consume(size_type count);
+
+        /**
+         * @brief Clear the buffer (neither producer nor consumer must be active)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        void clear();
+
+        /**
+         * @brief Operator overload [] (consumer)
+         *
+         * @param [in] index Index
+         *
+         * @returns Reference to element
+         */
+        reference operator[](size_type index);
+
+        /**
+         * @brief Operator overload [] (consumer)
+         *
+         * @param [in] index Index
+         *
+         * @returns Const reference to element
+         */
+        const_reference operator[](size_type index) const;
+
+    private:
+        static index_type Advance(index_type index, size_type count);
+        static size_type Offset(index_type index);
+        static size_type Distance(index_type write, index_type read);
+
+        _DataType _data[_Size];
+
+        Atomic _write;
+        Atomic _read;
+    };
+} // namespace Zhele::Containers
+
+#include "impl/spsc_ring_buffer.h"
+
+#endif //! ZHELE_SPSC_RINGBUFFER_H
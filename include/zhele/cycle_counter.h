@@ -0,0 +1,20 @@
+/**
+ * @file
+ * United header for core cycle counter
+ *
+ * @author Alexey Zhelonkin
+ * @license MIT
+ */
+
+#ifndef ZHELE_CYCLE_COUNTER_H
+#define ZHELE_CYCLE_COUNTER_H
+
+#include "platform_detector.h"
+
+#if defined(ZHELE_PLATFORM_STM32)
+  #include "platform/stm32/cycle_counter.h"
+#else
+  #error "Zhele: unsupported platform. Define ZHELE_PLATFORM_XX or include CMSIS device headers."
+#endif
+
+#endif // ZHELE_CYCLE_COUNTER_H
@@ -0,0 +1,20 @@
+/**
+ * @file
+ * United header for compile-time DMA channel allocator
+ *
+ * @author Alexey Zhelonkin
+ * @license MIT
+ */
+
+#ifndef ZHELE_DMA_ALLOCATOR_H
+#define ZHELE_DMA_ALLOCATOR_H
+
+#include "platform_detector.h"
+
+#if defined(ZHELE_PLATFORM_STM32)
+  #include "platform/stm32/dma_allocator.h"
+#else
+  #error "Zhele: unsupported platform. Define ZHELE_PLATFORM_XX or include CMSIS device headers."
+#endif
+
+#endif // ZHELE_DMA_ALLOCATOR_H
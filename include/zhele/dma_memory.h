@@ -0,0 +1,20 @@
+/**
+ * @file
+ * United header for DMA memory copy/fill service
+ *
+ * @author Alexey Zhelonkin
+ * @license MIT
+ */
+
+#ifndef ZHELE_DMA_MEMORY_H
+#define ZHELE_DMA_MEMORY_H
+
+#include "platform_detector.h"
+
+#if defined(ZHELE_PLATFORM_STM32)
+  #include "platform/stm32/dma_memory.h"
+#else
+  #error "Zhele: unsupported platform. Define ZHELE_PLATFORM_XX or include CMSIS device headers."
+#endif
+
+#endif // ZHELE_DMA_MEMORY_H
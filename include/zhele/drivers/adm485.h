@@ -72,19 +72,20 @@ namespace Zhele::Drivers
          * 
          * @param [in] data Data to write
          * @param [in] size Data size
-         * @param [in] async Write async or no
+         * @param [in] callback Write complete callback (optional)
          * 
          * @par Returns
          * 	Nothing
          */
-        static void WriteAsync(const void* data, size_t size, std::add_pointer_t<void()> callback = nullptr)
+        static void WriteAsync(const void* data, size_t size, Delegate<void()> callback = nullptr)
         {
             _DirectPin::Set();
-            Base::WriteAsync(data, size + 1, [callback](auto... unused){
+            _writeCallback = callback;
+            Base::WriteAsync(data, size + 1, [](void*, unsigned, bool){
                 while(!Base::WriteReady()) continue;
                 _DirectPin::Clear();
-                if(callback)
-                    callback();
+                if(_writeCallback)
+                    _writeCallback();
             });
         }
 
@@ -113,5 +114,7 @@ namespace Zhele::Drivers
             _DirectPin::template SetDriverType<_DirectPin::DriverType::PushPull>();
             _DirectPin::Clear();
         }
+
+        static inline Delegate<void()> _writeCallback;
     };
 }
\ No newline at end of file
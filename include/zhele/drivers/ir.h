@@ -12,6 +12,11 @@
 #ifndef ZHELE_DRIVERS_IR_H
 #define ZHELE_DRIVERS_IR_H
 
+#include "ir_timing.h"
+
+#include <cstdint>
+#include <type_traits>
+
 namespace Zhele::Drivers
 {
     /**
@@ -84,13 +89,13 @@ namespace Zhele::Drivers
                     TimeoutOCChannel::EnableInterrupt();
                 }
                 else {
-                    if(IsSimilar<_Decoder::StartWidth>(width) && IsSimilar<_Decoder::StartPulse>(pulse)) {
+                    if(IsSimilar<_Decoder, _Decoder::StartWidth>(width) && IsSimilar<_Decoder, _Decoder::StartPulse>(pulse)) {
                         _Decoder::Start();
                     }
-                    else if(IsSimilar<_Decoder::Width0>(width) && IsSimilar<_Decoder::Pulse0>(pulse)) {
+                    else if(IsSimilar<_Decoder, _Decoder::Width0>(width) && IsSimilar<_Decoder, _Decoder::Pulse0>(pulse)) {
                         _Decoder::Add0();
                     }
-                    else if(IsSimilar<_Decoder::Width1>(width) && IsSimilar<_Decoder::Pulse1>(pulse)) {
+                    else if(IsSimilar<_Decoder, _Decoder::Width1>(width) && IsSimilar<_Decoder, _Decoder::Pulse1>(pulse)) {
                         _Decoder::Add1();
                     }
                     else {
@@ -109,21 +114,6 @@ namespace Zhele::Drivers
                 }
             }
         }
-    private:
-        /**
-         * @brief Compare received value with decoder constant with given accuracy
-         * 
-         * @tparam _TargetValue Constant
-         * @param value Received value
-         * 
-         * @return true If value ~ _TargetValue
-         * @return false If value != _TargetValue
-         */
-        template<uint16_t _TargetValue>
-        inline static bool IsSimilar(uint16_t value)
-        {
-            return ((_TargetValue * (100 - _Decoder::EpsilonInPercent) / 100) < value) && (value < (_TargetValue * (100 + _Decoder::EpsilonInPercent) / 100));
-        }
     };
 
     /**
@@ -220,6 +210,41 @@ namespace Zhele::Drivers
                 _callback(static_cast<Command>(command));
         }
 
+        /**
+         * @brief Decode whole frame
+         *
+         * @details
+         * Frame is intervals between edges (Timers::PulseCapture with both edges captured, 1 us tick):
+         * start mark and space, then mark and space of each of 32 bits. Decode runs outside of interrupt,
+         * callback is called if frame is valid (the same as Handle).
+         *
+         * @param [in] frame Frame (Size() and operator[] of intervals)
+         *
+         * @retval true Frame has NEC layout
+         * @retval false Frame is not NEC frame (repeat code or noise)
+         */
+        template<typename _Frame>
+        static bool Decode(const _Frame& frame)
+        {
+            if(frame.Size() < 2 + 32 * 2 || !IsSimilar<NecDecoder, StartPulse>(frame[0]) || !IsSimilar<NecDecoder, StartWidth - StartPulse>(frame[1]))
+                return false;
+
+            Start();
+            for(unsigned bit = 0; bit < 32; ++bit)
+            {
+                uint32_t mark = frame[2 + bit * 2];
+                uint32_t space = frame[3 + bit * 2];
+                if(IsSimilar<NecDecoder, Pulse0>(mark) && IsSimilar<NecDecoder, Width0 - Pulse0>(space))
+                    Add0();
+                else if(IsSimilar<NecDecoder, Pulse1>(mark) && IsSimilar<NecDecoder, Width1 - Pulse1>(space))
+                    Add1();
+                else
+                    return false;
+            }
+            Handle();
+            return true;
+        }
+
     private:
         static uint32_t _frame;
         static Callback _callback;
@@ -0,0 +1,36 @@
+/**
+ * @file
+ * Interval comparison for IR decoders
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_DRIVERS_IR_TIMING_H
+#define ZHELE_DRIVERS_IR_TIMING_H
+
+#include <cstdint>
+
+namespace Zhele::Drivers
+{
+    /**
+     * @brief Compare received interval with decoder constant with decoder accuracy (EpsilonInPercent)
+     *
+     * @tparam _Decoder Decoder (NecDecoder)
+     * @tparam _TargetValue Constant
+     * @param [in] value Received interval
+     *
+     * @return true If value ~ _TargetValue
+     * @return false If value != _TargetValue
+     */
+    template<typename _Decoder, uint16_t _TargetValue>
+    inline bool IsSimilar(uint32_t value)
+    {
+        // Bounds are constants, so interrupt handler does not divide
+        constexpr uint32_t low = _TargetValue * (100 - _Decoder::EpsilonInPercent) / 100;
+        constexpr uint32_t high = _TargetValue * (100 + _Decoder::EpsilonInPercent) / 100;
+        return low < value && value < high;
+    }
+}
+#endif // !ZHELE_DRIVERS_IR_TIMING_H
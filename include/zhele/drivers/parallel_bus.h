@@ -0,0 +1,484 @@
+/**
+ * @file
+ * Implements Intel 8080 / Motorola 6800 parallel bus for displays
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_DRIVERS_PARALLEL_BUS_H
+#define ZHELE_DRIVERS_PARALLEL_BUS_H
+
+#include <zhele/common/delegate.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace Zhele::Drivers
+{
+    /// Parallel bus protocol
+    enum class ParallelBusMode
+    {
+        Intel8080, ///< WR and RD strobes (active low), display latches data on WR rising edge
+        Motorola6800 ///< R/W select (low - write) and E strobe (active high), display latches data on E falling edge
+    };
+
+    /**
+     * @brief Timer and DMA configuration of parallel bus writes
+     *
+     * @details
+     * Timer generates WR strobes as PWM on WR pin (one period per data item): WR is high in the first
+     * half of period and low in the second one. Compare event of WR channel (falling edge) requests DMA,
+     * DMA moves next item from memory to data port ODR, display latches it at WR rising edge (update).
+     * Timer runs in one-pulse mode with repetition counter, so it makes exactly as many strobes as items
+     * are transferred (by chunks of 256 items).
+     *
+     * @tparam _Timer Advanced timer (with repetition counter), WR pin must be output of its channel
+     * @tparam _WrChannel Timer channel of WR pin (0..3)
+     * @tparam _DmaChannel DMA channel of timer channel compare request (must have access to GPIO: DMA2 on F4)
+     * @tparam _CycleTicks Write cycle (timer clock ticks)
+     */
+    template<typename _Timer, unsigned _WrChannel, typename _DmaChannel, uint16_t _CycleTicks = 8>
+    struct ParallelBusDma
+    {
+        static_assert(_CycleTicks >= 2, "Write cycle must contain both WR phases");
+
+        using Timer = _Timer;
+        using WrChannel = typename _Timer::template PWMGeneration<_WrChannel>;
+        using DmaChannel = _DmaChannel;
+        static constexpr uint16_t CycleTicks = _CycleTicks;
+    };
+
+    /**
+     * @brief Implements Intel 8080 / Motorola 6800 parallel bus (display interface)
+     *
+     * @details
+     * Bus has the same interface as SPI (Write, WriteAsync, WriteAsyncNoIncrement, SetDataSize, Busy),
+     * so it can be used by display drivers instead of SPI, for example
+     * St7735<Bus, Bus::CsPin, Bus::DcPin, ResetPin>. Chip select and data/command pins are driven
+     * by display driver (or by WriteCommand/Select/Deselect methods).
+     *
+     * Without DMA configuration asynchronous writes are made by CPU and callback is called before return.
+     * With DMA configuration they are made by timer and DMA (8080 bus only), data pins must be
+     * 8 or 16 low pins of one port (Px0..Px7 or Px0..Px15): DMA writes items into ODR.
+     * Fill with 16-bit frame on 8-bit bus is written by DMA from two-byte pattern (high byte first),
+     * 16-bit frames buffer on 8-bit bus (little-endian in memory) and 8-bit frames on 16-bit bus
+     * are written by CPU. F1 APB bridge duplicates bytes written to ODR,
+     * so with 8-bit bus pins Px8..Px15 must not be outputs during DMA writes.
+     * Timer update interrupt handler must call IrqHandler.
+     *
+     * @par Example
+     * @code
+     * using Bus = ParallelBus<IO::PinList<IO::Pb0, ..., IO::Pb7>, IO::Pa8, IO::Pa3, IO::Pa1, IO::Pa2,
+     *     ParallelBusMode::Intel8080, ParallelBusDma<Timer1, 0, Dma1Channel2>>;
+     * extern "C" void TIM1_UP_IRQHandler() { Bus::IrqHandler(); }
+     * @endcode
+     *
+     * @tparam _DataPins Data pins (8 or 16 pins PinList)
+     * @tparam _WrPin WR (8080) or R/W (6800) pin
+     * @tparam _RdPin RD (8080) or E (6800) pin (IO::NullPin for write-only 8080 bus)
+     * @tparam _DcPin Data/command pin
+     * @tparam _CsPin Chip select pin
+     * @tparam _Mode Bus protocol
+     * @tparam _Dma DMA configuration (ParallelBusDma) or void (CPU writes only)
+     */
+    template<typename _DataPins, typename _WrPin, typename _RdPin, typename _DcPin, typename _CsPin,
+        ParallelBusMode _Mode = ParallelBusMode::Intel8080, typename _Dma = void>
+    class ParallelBus
+    {
+        using DataType = typename _DataPins::DataType;
+        static constexpr unsigned Width = std::numeric_limits<DataType>::digits;
+        static constexpr bool DmaWrites = !std::is_void_v<_Dma>;
+
+        static_assert(Width == 8 || Width == 16, "Parallel bus data width must be 8 or 16 bits");
+        static_assert(!DmaWrites || _Mode == ParallelBusMode::Intel8080, "DMA writes are supported only on 8080 bus");
+
+    public:
+        using CsPin = _CsPin;
+        using DcPin = _DcPin;
+        using TransferCallback = Delegate<void(void* data, unsigned size, bool success)>;
+
+        /// Frame size
+        enum DataSize : uint8_t
+        {
+            DataSize8 = 8, ///< 8 bits
+            DataSize16 = 16 ///< 16 bits (two strobes on 8-bit bus, high byte first)
+        };
+
+        /**
+         * @brief Configure bus pins (and timer with DMA configuration)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init()
+        {
+            _DataPins::Enable();
+            _DataPins::SetConfiguration(_DataPins::Configuration::Out);
+            _DataPins::SetDriverType(_DataPins::DriverType::PushPull);
+            _DataPins::SetSpeed(_DataPins::Speed::Fast);
+
+            // Idle state: 8080 strobes are high, 6800 E is low and R/W selects write
+            if constexpr (_Mode == ParallelBusMode::Intel8080)
+            {
+                _WrPin::Set();
+                _RdPin::Set();
+            }
+            else
+            {
+                _WrPin::Clear();
+                _RdPin::Clear();
+            }
+            _DcPin::Set();
+            _CsPin::Set();
+
+            ConfigureOutput<_WrPin>();
+            ConfigureOutput<_RdPin>();
+            ConfigureOutput<_DcPin>();
+            ConfigureOutput<_CsPin>();
+
+            if constexpr (DmaWrites)
+            {
+                using Timer = typename _Dma::Timer;
+                using WrChannel = typename _Dma::WrChannel;
+
+                static_assert(DataPinsAreLowPortBits(), "DMA writes require data pins Px0..Px7 (Px0..Px15) of one port");
+
+                Timer::Enable();
+                Timer::SetPrescaler(0);
+                Timer::EnableOnePulseMode();
+                WrChannel::SetPulse(_Dma::CycleTicks / 2);
+                WrChannel::SetOutputPolarity(WrChannel::OutputPolarity::ActiveHigh);
+                WrChannel::SetOutputMode(WrChannel::OutputMode::PWM1);
+                WrChannel::EnableDmaRequest();
+                Timer::EnableInterrupt();
+            }
+        }
+
+        /**
+         * @brief Set frame size
+         *
+         * @param [in] dataSize Frame size
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void SetDataSize(DataSize dataSize)
+        {
+            _dataSize = dataSize;
+        }
+
+        /**
+         * @brief Write frame
+         *
+         * @param [in] data Frame
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Write(uint16_t data)
+        {
+            if (Width == 8 && _dataSize == DataSize16)
+            {
+                WriteItem(static_cast<DataType>(data >> 8));
+                WriteItem(static_cast<DataType>(data & 0xff));
+            }
+            else
+            {
+                WriteItem(static_cast<DataType>(data));
+            }
+        }
+
+        /**
+         * @brief Read frame
+         *
+         * @returns Frame
+         */
+        static uint16_t Read()
+        {
+            _DataPins::SetConfiguration(_DataPins::Configuration::In);
+
+            uint16_t result;
+            if (Width == 8 && _dataSize == DataSize16)
+            {
+                result = ReadItem() << 8;
+                result |= ReadItem();
+            }
+            else
+            {
+                result = ReadItem();
+            }
+
+            _DataPins::SetConfiguration(_DataPins::Configuration::Out);
+            return result;
+        }
+
+        /**
+         * @brief Write command (DC is low during command write)
+         *
+         * @param [in] command Command
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void WriteCommand(uint8_t command)
+        {
+            _DcPin::Clear();
+            WriteItem(command);
+            _DcPin::Set();
+        }
+
+        /**
+         * @brief Select display (CS low)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Select()
+        {
+            _CsPin::Clear();
+        }
+
+        /**
+         * @brief Deselect display (CS high)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Deselect()
+        {
+            _CsPin::Set();
+        }
+
+        /**
+         * @brief Write frames buffer asynchronously
+         *
+         * @param [in] data Frames (uint8_t or uint16_t items, according to frame size)
+         * @param [in] size Frames count
+         * @param [in] callback Completion callback
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void WriteAsync(const void* data, uint16_t size, TransferCallback callback = nullptr)
+        {
+            Transfer(data, size, true, callback);
+        }
+
+        /**
+         * @brief Write the same frame several times asynchronously (fill)
+         *
+         * @param [in] data Frame (uint8_t or uint16_t, according to frame size), must be valid until transfer is complete
+         * @param [in] size Repetitions count
+         * @param [in] callback Completion callback
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void WriteAsyncNoIncrement(const void* data, uint16_t size, TransferCallback callback = nullptr)
+        {
+            Transfer(data, size, false, callback);
+        }
+
+        /**
+         * @brief Returns bus state
+         *
+         * @retval true Asynchronous write is in progress
+         * @retval false Bus is free
+         */
+        static bool Busy()
+        {
+            return _busy;
+        }
+
+        /**
+         * @brief Timer update interrupt handler (DMA writes only)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void IrqHandler()
+            requires DmaWrites
+        {
+            using Timer = typename _Dma::Timer;
+
+            if (!Timer::IsInterrupt())
+                return;
+            Timer::ClearInterruptFlag();
+
+            if (_remaining > 0)
+            {
+                StartChunk();
+                return;
+            }
+
+            // Pattern fill runs DMA in circular mode
+            _Dma::DmaChannel::Disable();
+            _WrPin::Set();
+            _WrPin::SetConfiguration(_WrPin::Configuration::Out);
+            Complete();
+        }
+
+    private:
+        /// Timer repetition counter is 8-bit (one-pulse mode stops timer after RCR + 1 strobes)
+        static constexpr uint16_t MaxChunk = 256;
+
+        template<typename _Pin>
+        static void ConfigureOutput()
+        {
+            _Pin::Port::Enable();
+            _Pin::SetConfiguration(_Pin::Configuration::Out);
+            _Pin::SetDriverType(_Pin::DriverType::PushPull);
+            _Pin::SetSpeed(_Pin::Speed::Fast);
+        }
+
+        static consteval bool DataPinsAreLowPortBits()
+        {
+            using Port = typename _DataPins::template Pin<0>::Port;
+            return []<unsigned... _Index>(std::integer_sequence<unsigned, _Index...>) {
+                return ((_DataPins::template Pin<_Index>::Number == _Index
+                    && std::is_same_v<typename _DataPins::template Pin<_Index>::Port, Port>) && ...);
+            }(std::make_integer_sequence<unsigned, Width>{});
+        }
+
+        static void WriteItem(DataType value)
+        {
+            _DataPins::Write(value);
+            if constexpr (_Mode == ParallelBusMode::Intel8080)
+            {
+                _WrPin::Clear();
+                _WrPin::Set();
+            }
+            else
+            {
+                _RdPin::Set();
+                _RdPin::Clear();
+            }
+        }
+
+        static DataType ReadItem()
+        {
+            DataType value;
+            if constexpr (_Mode == ParallelBusMode::Intel8080)
+            {
+                _RdPin::Clear();
+                value = _DataPins::PinRead();
+                _RdPin::Set();
+            }
+            else
+            {
+                _WrPin::Set();
+                _RdPin::Set();
+                value = _DataPins::PinRead();
+                _RdPin::Clear();
+                _WrPin::Clear();
+            }
+            return value;
+        }
+
+        static void Transfer(const void* data, uint16_t size, bool increment, TransferCallback callback)
+        {
+            while (_busy)
+                continue;
+
+            _busy = true;
+            _data = data;
+            _size = size;
+            _callback = callback;
+
+            if constexpr (DmaWrites)
+            {
+                bool frameIsItem = (_dataSize == DataSize16) == (Width == 16);
+                bool patternFill = Width == 8 && _dataSize == DataSize16 && !increment;
+                if ((frameIsItem || patternFill) && size > 0)
+                {
+                    StartDma(data, size, increment);
+                    return;
+                }
+            }
+
+            if (_dataSize == DataSize16)
+            {
+                const uint16_t* frames = static_cast<const uint16_t*>(data);
+                for (uint16_t i = 0; i < size; ++i)
+                    Write(frames[increment ? i : 0]);
+            }
+            else
+            {
+                const uint8_t* frames = static_cast<const uint8_t*>(data);
+                for (uint16_t i = 0; i < size; ++i)
+                    WriteItem(frames[increment ? i : 0]);
+            }
+            Complete();
+        }
+
+        static void StartDma(const void* data, uint16_t size, bool increment)
+        {
+            using DmaChannel = typename _Dma::DmaChannel;
+            using WrChannel = typename _Dma::WrChannel;
+            using DataPort = typename _DataPins::template Pin<0>::Port;
+
+            auto mode = DmaChannel::Mem2Periph | (Width == 16
+                ? DmaChannel::MSize16Bits | DmaChannel::PSize16Bits
+                : DmaChannel::MSize8Bits | DmaChannel::PSize8Bits);
+            if (increment)
+                mode = mode | DmaChannel::MemIncrement;
+
+            DmaChannel::SetTransferCallback(nullptr);
+            if (Width == 8 && _dataSize == DataSize16)
+            {
+                // Two strobes per frame: DMA repeats high and low bytes until timer stops
+                uint16_t frame = *static_cast<const uint16_t*>(data);
+                _pattern[0] = static_cast<uint8_t>(frame >> 8);
+                _pattern[1] = static_cast<uint8_t>(frame & 0xff);
+                DmaChannel::Transfer(mode | DmaChannel::MemIncrement | DmaChannel::Circular, _pattern, &DataPort::Regs::Get()->ODR, 2);
+                _remaining = 2 * uint32_t(size);
+            }
+            else
+            {
+                DmaChannel::Transfer(mode, data, &DataPort::Regs::Get()->ODR, size);
+                _remaining = size;
+            }
+
+            WrChannel::template SelectPins<_WrPin>();
+            _WrPin::SetSpeed(_WrPin::Speed::Fast);
+
+            StartChunk();
+        }
+
+        static void StartChunk()
+        {
+            using Timer = typename _Dma::Timer;
+
+            uint16_t chunk = _remaining < MaxChunk ? static_cast<uint16_t>(_remaining) : MaxChunk;
+            _remaining -= chunk;
+
+            // Update event loads repetition counter, it must not call handler
+            Timer::DisableInterrupt();
+            Timer::SetRepetitionCounter(chunk - 1);
+            Timer::SetPeriodAndUpdate(_Dma::CycleTicks - 1);
+            Timer::ClearInterruptFlag();
+            Timer::EnableInterrupt();
+            Timer::Start();
+        }
+
+        static void Complete()
+        {
+            _busy = false;
+            if (_callback)
+                _callback(const_cast<void*>(_data), _size, true);
+        }
+
+        static inline volatile bool _busy = false;
+        static inline DataSize _dataSize = DataSize8;
+        static inline uint32_t _remaining = 0; ///< Strobes count
+        static inline uint8_t _pattern[2] {}; ///< 16-bit fill frame on 8-bit bus
+        static inline const void* _data = nullptr;
+        static inline uint16_t _size = 0;
+        static inline TransferCallback _callback;
+    };
+}
+
+#endif //! ZHELE_DRIVERS_PARALLEL_BUS_H
@@ -12,6 +12,8 @@
 #include <zhele/spi.h>
 #include <zhele/delay.h>
 
+#include <cstring>
+
 namespace Zhele
 {
     namespace Drivers
@@ -239,9 +241,28 @@ namespace Zhele
              */
             static void WriteRegister(Registers registerAddress, uint8_t value)
             {
+                uint8_t request[] = {static_cast<uint8_t>((static_cast <uint8_t>(registerAddress) << 1) & 0x7e), value};
+                _SSPin::Clear();
+                _SpiBus::Transfer(request, nullptr, sizeof(request));
+                _SSPin::Set();
+            }
+
+            /**
+             * @brief Writes values to register (FIFO data) by one SPI transaction
+             * 
+             * @param [in] registerAddress Register address
+             * @param [in] data Values for write
+             * @param [in] size Values count
+             * 
+             * @par Returns
+             *	Nothing
+             */
+            static void WriteRegister(Registers registerAddress, const uint8_t* data, uint8_t size)
+            {
+                uint8_t address = (static_cast <uint8_t>(registerAddress) << 1) & 0x7e;
                 _SSPin::Clear();
-                _SpiBus::Send((static_cast <uint8_t>(registerAddress) << 1) & 0x7e);
-                _SpiBus::Send(value);
+                _SpiBus::Transfer(&address, nullptr, 1);
+                _SpiBus::Transfer(data, nullptr, size);
                 _SSPin::Set();
             }
 
@@ -254,11 +275,34 @@ namespace Zhele
              */
             static uint8_t ReadRegister(Registers registerAddress)
             {
+                uint8_t buffer[] = {static_cast<uint8_t>(((static_cast <uint8_t >(registerAddress) << 1) & 0x7e) | 0x80), 0x00};
+                _SSPin::Clear();
+                _SpiBus::Transfer(buffer, buffer, sizeof(buffer));
+                _SSPin::Set();
+                return buffer[1];
+            }
+
+            /**
+             * @brief Reads register (FIFO data) several times by one SPI transaction
+             * 
+             * @param [in] registerAddress Register address
+             * @param [out] data Readed values
+             * @param [in] size Values count (not greater than MaxDataSize)
+             * 
+             * @par Returns
+             *	Nothing
+             */
+            static void ReadRegister(Registers registerAddress, uint8_t* data, uint8_t size)
+            {
+                // Address is sent before each read, value is received in next frame
+                uint8_t buffer[MaxDataSize + 1];
+                std::memset(buffer, ((static_cast <uint8_t >(registerAddress) << 1) & 0x7e) | 0x80, size);
+                buffer[size] = 0x00;
+
                 _SSPin::Clear();
-                _SpiBus::Write(((static_cast <uint8_t >(registerAddress) << 1) & 0x7e) | 0x80);
-                uint8_t readed = _SpiBus::Read();
+                _SpiBus::Transfer(buffer, buffer, size + 1);
                 _SSPin::Set();
-                return readed;
+                std::memcpy(data, buffer + 1, size);
             }
 
             /**
@@ -387,10 +431,7 @@ namespace Zhele
 
                 WriteRegister(Registers::Command, static_cast <uint8_t >(Commands::Idle));
 
-                for (int i = 0; i < transmitDataSize; ++i)
-                {
-                    WriteRegister(Registers::FifoData, transmitData[i]);
-                }
+                WriteRegister(Registers::FifoData, transmitData, transmitDataSize);
 
                 WriteRegister(Registers::Command, static_cast <uint8_t >(command));
 
@@ -442,10 +483,7 @@ namespace Zhele
                         fifoSize = MaxDataSize;
                     }
 
-                    for (int i = 0; i < fifoSize; ++i)
-                    {
-                        receiveData[i] = ReadRegister(Registers::FifoData);
-                    }
+                    ReadRegister(Registers::FifoData, receiveData, fifoSize);
                     
                 }
 
@@ -481,10 +519,7 @@ namespace Zhele
                 ClearBitMask(Registers::DivIrq, 0x04);
                 SetBitMask(Registers::FifoLevel, 0x80);
 
-                for (int i = 0; i < size; ++i)
-                {
-                    WriteRegister(Registers::FifoData, data[i]);
-                }
+                WriteRegister(Registers::FifoData, data, size);
                 WriteRegister(Registers::Command, static_cast <uint8_t >(Commands::CalculateCRC));
 
                 uint8_t timeout = 0xff;
@@ -13,6 +13,8 @@
 #include <zhele/delay.h>
 #include <zhele/binary_stream.h>
 
+#include <type_traits>
+
 namespace Zhele::Drivers
 {
     /// SD card command
@@ -146,7 +148,11 @@ namespace Zhele::Drivers
                 _CsPin::Set();
                 return false;
             }
-            Spi. template Read<ReadIterator>(iter, size);
+            // Byte buffer is read by block transfer (no gaps between SPI frames)
+            if constexpr (std::is_pointer_v<ReadIterator> && sizeof(std::remove_pointer_t<ReadIterator>) == 1)
+                _SpiModule::Transfer(nullptr, iter, size);
+            else
+                Spi. template Read<ReadIterator>(iter, size);
             uint16_t crc = Spi.ReadU16Le();
             if(useCrc)
             {
@@ -216,7 +222,10 @@ namespace Zhele::Drivers
                 }
 
                 Spi.Write(0xFE);
-                Spi.template Write<WriteIterator>(iter, 512);
+                if constexpr (std::is_pointer_v<WriteIterator> && sizeof(std::remove_pointer_t<WriteIterator>) == 1)
+                    _SpiModule::Transfer(iter, nullptr, 512);
+                else
+                    Spi.template Write<WriteIterator>(iter, 512);
                 Spi.ReadU16Be();
                 uint8_t resp;
                 if((resp = Spi.Read() & 0x1F) != 0x05)
@@ -0,0 +1,20 @@
+/**
+ * @file
+ * United header for monotonic clock
+ *
+ * @author Alexey Zhelonkin
+ * @license MIT
+ */
+
+#ifndef ZHELE_MONOTONIC_CLOCK_H
+#define ZHELE_MONOTONIC_CLOCK_H
+
+#include "platform_detector.h"
+
+#if defined(ZHELE_PLATFORM_STM32)
+  #include "platform/stm32/monotonic_clock.h"
+#else
+  #error "Zhele: unsupported platform. Define ZHELE_PLATFORM_XX or include CMSIS device headers."
+#endif
+
+#endif // ZHELE_MONOTONIC_CLOCK_H
@@ -0,0 +1,20 @@
+/**
+ * @file
+ * United header for GPIO configuration aggregator
+ *
+ * @author Alexey Zhelonkin
+ * @license MIT
+ */
+
+#ifndef ZHELE_PIN_CONFIGURATION_H
+#define ZHELE_PIN_CONFIGURATION_H
+
+#include "platform_detector.h"
+
+#if defined(ZHELE_PLATFORM_STM32)
+  #include "platform/stm32/pin_configuration.h"
+#else
+  #error "Zhele: unsupported platform. Define ZHELE_PLATFORM_XX or include CMSIS device headers."
+#endif
+
+#endif // ZHELE_PIN_CONFIGURATION_H
@@ -99,6 +99,16 @@ namespace Zhele
         };
 
         IO_STRUCT_WRAPPER(I2C1, I2c1Regs, I2C_TypeDef);
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::EnableFastModePlus()
+        {
+            Clock::SysCfgClock::Enable();
+        #if defined (SYSCFG_CFGR1_I2C1_FMP)
+            if constexpr (std::is_same_v<_Regs, I2c1Regs>)
+                SYSCFG->CFGR1 |= SYSCFG_CFGR1_I2C1_FMP;
+        #endif
+        }
     }
 
 // TODO:: Implement DMAMUX for use DMA
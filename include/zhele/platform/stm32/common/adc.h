@@ -9,11 +9,13 @@
 #ifndef ZHELE_PLATFORM_STM32_COMMON_ADC_H
 #define ZHELE_PLATFORM_STM32_COMMON_ADC_H
 
+#include <zhele/common/delegate.h>
+
 #include <initializer_list>
 
 namespace Zhele
 {
-    using AdcCallbackType = std::add_pointer_t<void(uint16_t* data, uint32_t count)>;
+    using AdcCallbackType = Delegate<void(uint16_t* data, uint32_t count)>;
 
     namespace Private
     {
@@ -0,0 +1,171 @@
+/**
+ * @file
+ * Implements core cycle counter (DWT CYCCNT or free running SysTick)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_CYCLE_COUNTER_H
+#define ZHELE_PLATFORM_STM32_COMMON_CYCLE_COUNTER_H
+
+#include "ioreg.h"
+
+#include <cstdint>
+
+namespace Zhele
+{
+    namespace Private
+    {
+    #if defined(DWT_CTRL_CYCCNTENA_Msk)
+        IO_STRUCT_WRAPPER(CoreDebug, CoreDebugRegs, CoreDebug_Type);
+        IO_STRUCT_WRAPPER(DWT, DwtRegs, DWT_Type);
+    #else
+        IO_STRUCT_WRAPPER(SysTick, SysTickRegs, SysTick_Type);
+    #endif
+    }
+
+    /**
+     * @brief Core cycle counter
+     *
+     * @details
+     * Cortex-M3/M4 cores (F1, F4, L4) count cycles by DWT CYCCNT (32 bits).
+     * Cortex-M0/M0+ cores (F0, G0, C0) have no DWT cycle counter, so SysTick is used.
+     * Running SysTick (system tick timer configured by user) is never reconfigured: counter
+     * period is its reload value (LOAD + 1 ticks, 8 cycles per tick with HCLK/8 clock).
+     * Stopped SysTick is started by Enable as free running 24-bit counter clocked by core clock.
+     *
+     * Intervals are computed modulo counter period, so measured (and waited) interval
+     * must be shorter than counter period: Mask cycles for DWT and free running SysTick
+     * (~0.2 s at 72 MHz), SysTick reload period otherwise (1 ms for 1 kHz system tick).
+     */
+    class CycleCounter
+    {
+    public:
+        using Ticks = uint32_t;
+
+    #if defined(DWT_CTRL_CYCCNTENA_Msk)
+        static constexpr Ticks Mask = 0xffffffffu;
+    #else
+        static constexpr Ticks Mask = SysTick_LOAD_RELOAD_Msk;
+    #endif
+
+        /**
+         * @brief Enables cycle counter (does nothing if it is already running)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Enable();
+
+        /**
+         * @brief Returns current counter value
+         *
+         * @returns Cycles (modulo counter period)
+         */
+        static Ticks Now();
+
+        /**
+         * @brief Returns cycles elapsed since given counter value
+         *
+         * @param [in] since Counter value
+         *
+         * @returns Elapsed cycles
+         */
+        static Ticks Elapsed(Ticks since);
+
+        /**
+         * @brief Returns cycles elapsed between two counter values
+         *
+         * @param [in] since Earlier counter value
+         * @param [in] now Later counter value
+         *
+         * @returns Elapsed cycles
+         */
+        static Ticks Elapsed(Ticks since, Ticks now);
+
+        /**
+         * @brief Waits for next edge of periodic signal
+         *
+         * @details
+         * Edges are scheduled on counter timeline (edge + period), so time spent by
+         * caller between waits doesn't accumulate to period error. If caller is late more
+         * than one period (period is shorter than caller code), edge is resynchronized
+         * to current time and signal runs as fast as caller code.
+         *
+         * @param [in, out] edge Previous edge time (updated to this edge time)
+         * @param [in] period Period in cycles
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void WaitPeriod(Ticks& edge, Ticks period);
+
+        /**
+         * @brief Waits given cycles count
+         *
+         * @param [in] cycles Cycles count
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Delay(Ticks cycles);
+
+    #if !defined(DWT_CTRL_CYCCNTENA_Msk)
+    private:
+        /// Returns SysTick period in cycles
+        static Ticks Period();
+        /// Returns cycles per SysTick tick
+        static Ticks TickCycles();
+    #endif
+    };
+
+    /**
+     * @brief Measures cycles spent in scope
+     *
+     * @details
+     * Elapsed cycles are written to result on scope exit, so hot paths can be profiled in-field
+     * (cycle counter must be enabled, see CycleCounter::Enable). Measured scope must be shorter
+     * than counter period (see CycleCounter).
+     *
+     * @par Example
+     * @code
+     * static CycleCounter::Ticks handlerCycles;
+     * extern "C" void USART1_IRQHandler()
+     * {
+     *     ScopedCycles measure(handlerCycles);
+     *     Usart1::IRQHandler();
+     * }
+     * @endcode
+     */
+    class ScopedCycles
+    {
+    public:
+        /**
+         * @brief Constructor (starts measurement)
+         *
+         * @param [out] result Elapsed cycles (written by destructor)
+         */
+        explicit ScopedCycles(CycleCounter::Ticks& result)
+            : _result(result)
+            , _start(CycleCounter::Now())
+        {}
+
+        ~ScopedCycles()
+        {
+            _result = CycleCounter::Elapsed(_start);
+        }
+
+        ScopedCycles(const ScopedCycles&) = delete;
+        ScopedCycles& operator=(const ScopedCycles&) = delete;
+
+    private:
+        CycleCounter::Ticks& _result;
+        CycleCounter::Ticks _start;
+    };
+}
+
+#include "impl/cycle_counter.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_CYCLE_COUNTER_H
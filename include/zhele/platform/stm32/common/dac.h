@@ -12,6 +12,7 @@
 #include <cstdint>
 
 #include <zhele/clock.h>
+#include <zhele/dma.h>
 
 namespace Zhele
 {
@@ -174,6 +175,42 @@ namespace Zhele
              *  Nothing
              */
             static void CauseSoftwareTrigger();
+
+            /**
+             * @brief Enable DMA request (on trigger event)
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void EnableDma();
+
+            /**
+             * @brief Disable DMA request
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void DisableDma();
+
+            /**
+             * @brief Write 12-bit right-aligned samples from descriptor list by DMA
+             * 
+             * @details
+             * Samples are converted on trigger event, so channel must be initialized with trigger
+             * (timer TRGO for example). DMA interrupt handler must call _DmaChannel::IrqHandler.
+             * 
+             * @tparam _DmaChannel DMA channel (stream with channel) connected to DAC channel
+             * 
+             * @param descriptors Descriptor list (sizes are samples count)
+             * @param count Descriptors count
+             * @param circular Restart list after last descriptor
+             * @param callback Transfer complete callback (called after each list pass)
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            template <typename _DmaChannel>
+            static void WriteAsyncList(const DmaDescriptor* descriptors, uint16_t count, bool circular = false, DmaChannelData::TransferCallback callback = nullptr);
         };
 #if defined (DAC1)
         IO_STRUCT_WRAPPER(DAC1, Dac1Regs, DAC_TypeDef);
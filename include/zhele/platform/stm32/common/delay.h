@@ -0,0 +1,92 @@
+/**
+ * @file
+ * Implements delays counted by core cycle counter
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_DELAY_H
+#define ZHELE_PLATFORM_STM32_COMMON_DELAY_H
+
+#include <zhele/cycle_counter.h>
+
+#include <cstdint>
+
+namespace Zhele
+{
+    namespace Private
+    {
+        /**
+         * @brief Waits given core cycles count
+         *
+         * @details
+         * Cycle counter is enabled on first use. On Cortex-M0/M0+ running SysTick (system tick timer
+         * configured by user) is not reconfigured (see CycleCounter), delay may exceed its period.
+         *
+         * @param [in] cycles Core cycles count
+         *
+         * @par Returns
+         *	Nothing
+         */
+        void DelayCycles(uint32_t cycles);
+
+        /**
+         * @brief Converts time to core cycles (rounded up)
+         *
+         * @tparam _Ns Nanoseconds
+         * @tparam _CpuFreq Core clock frequency
+         */
+        template<unsigned long long _Ns, unsigned long _CpuFreq>
+        constexpr uint64_t NanosecondsToCycles = (_Ns * _CpuFreq + 999999999ull) / 1000000000ull;
+    }
+
+    /**
+     * @brief Nanoseconds delay
+     *
+     * @details
+     * Delay is counted by core cycle counter (DWT CYCCNT or SysTick, see CycleCounter), so it doesn't
+     * depend on compiler and optimization options. Delay is never shorter than requested,
+     * call overhead (a few dozens of cycles) limits resolution of short delays.
+     *
+     * @tparam ns Nanoseconds
+     * @tparam CpuFreq Core clock frequency
+     */
+    template<unsigned long ns, unsigned long CpuFreq = F_CPU>
+    void delay_ns()
+    {
+        static_assert(Private::NanosecondsToCycles<ns, CpuFreq> <= UINT32_MAX, "Delay is too long, use delay_ms");
+        Private::DelayCycles(Private::NanosecondsToCycles<ns, CpuFreq>);
+    }
+
+    /**
+     * @brief Microseconds delay
+     *
+     * @tparam us Microseconds
+     * @tparam CpuFreq Core clock frequency
+     */
+    template<unsigned long us, unsigned long CpuFreq = F_CPU>
+    void delay_us()
+    {
+        static_assert(Private::NanosecondsToCycles<us * 1000ull, CpuFreq> <= UINT32_MAX, "Delay is too long, use delay_ms");
+        Private::DelayCycles(Private::NanosecondsToCycles<us * 1000ull, CpuFreq>);
+    }
+
+    /**
+     * @brief Milliseconds delay
+     *
+     * @tparam ms Milliseconds
+     * @tparam CpuFreq Core clock frequency
+     */
+    template<unsigned long ms, unsigned long CpuFreq = F_CPU>
+    void delay_ms()
+    {
+        for(unsigned long i = 0; i < ms; ++i)
+            Private::DelayCycles(Private::NanosecondsToCycles<1000000ull, CpuFreq>);
+    }
+}
+
+#include "impl/delay.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_DELAY_H
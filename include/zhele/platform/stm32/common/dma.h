@@ -10,6 +10,7 @@
 #ifndef ZHELE_PLATFORM_STM32_COMMON_DMA_H
 #define ZHELE_PLATFORM_STM32_COMMON_DMA_H
 
+#include <zhele/common/delegate.h>
 #include <zhele/common/template_utils/enum.h>
 #include "ioreg.h"
 
@@ -114,7 +115,7 @@ namespace Zhele
      */
     struct DmaChannelData
     {
-        using TransferCallback = std::add_pointer_t<void(void* data, unsigned size, bool success)>;
+        using TransferCallback = Delegate<void(void* data, unsigned size, bool success)>;
         /**
          * @brief Default constructor
          *
@@ -149,6 +150,23 @@ namespace Zhele
         inline void NotifyError();
     };
 
+    /**
+     * @brief DMA descriptor (one memory block of descriptor list transfer)
+     *
+     * @tparam _Buffer Memory buffer type (const void if memory is read by DMA)
+     */
+    template<typename _Buffer>
+    struct BasicDmaDescriptor
+    {
+        _Buffer* buffer; ///< Memory buffer
+        uint16_t size; ///< Items count (descriptor with zero size is skipped)
+    };
+
+    /// Descriptor of memory block that is read by DMA (Mem2Periph)
+    using DmaDescriptor = BasicDmaDescriptor<const void>;
+    /// Descriptor of memory block that is written by DMA (Periph2Mem, Mem2Mem destination)
+    using DmaReceiveDescriptor = BasicDmaDescriptor<void>;
+
     /**
      * @brief Implements DMA channel
      *
@@ -164,6 +182,7 @@ namespace Zhele
         static DmaChannelData Data;
     public:
         using Module = _Module;
+        using Regs = _ChannelRegs;
         using DmaBase::Mode;
         static constexpr unsigned Channel = _Channel;
 
@@ -181,10 +200,95 @@ namespace Zhele
         static void Transfer(Mode mode, const void* buffer, volatile void* periph, uint32_t bufferSize
         ONLY_IF_STREAM_SUPPORTED(COMMA uint8_t channel = 0));
 
+        /**
+         * @brief Initialize DMA channel and start descriptor list (scatter-gather) transfer
+         *
+         * @details
+         * Descriptors are transferred back-to-back: transfer complete interrupt reloads
+         * memory address and items count from next descriptor, so IrqHandler must be called
+         * from channel interrupt handler. Mode and peripheral address are common for all descriptors.
+         * Circular mode restarts list after last descriptor (callback is called on each pass).
+         * Transfer callback receives descriptor list as data and descriptors count as size.
+         * Descriptors with zero size are skipped (zero items count never completes), if all of them
+         * are empty callback is called at once.
+         *
+         * @tparam _Buffer Memory buffer type (DmaDescriptor for Mem2Periph, DmaReceiveDescriptor otherwise)
+         *
+         * @param [in] mode Channel mode (support logic operations, OR ("||") for example)
+         * @param [in] descriptors Descriptor list (must be valid until transfer is complete)
+         * @param [in] count Descriptors count
+         * @param [in] periph Peripheral address (or second memory buffer in Mem2Mem case)
+         * @param [in] channel Channel (for DMA with streams)
+         * @par Returns
+         *	Nothing
+         */
+        template<typename _Buffer>
+        static void TransferList(Mode mode, const BasicDmaDescriptor<_Buffer>* descriptors, uint16_t count, volatile void* periph
+        ONLY_IF_STREAM_SUPPORTED(COMMA uint8_t channel = 0));
+
+        /**
+         * @brief Returns index of descriptor in progress (for descriptor list transfer)
+         *
+         * @returns Descriptor index
+         */
+        static uint16_t CurrentDescriptor();
+
+    #if defined(DMA_SxCR_DBM)
+        /**
+         * @brief Initialize DMA stream and start double-buffer (DBM) transfer
+         *
+         * @details
+         * Stream runs continuously and switches between buffers after each buffer is complete.
+         * Transfer callback is called after each buffer with completed (now idle) buffer as data.
+         *
+         * @param [in] mode Channel mode (support logic operations, OR ("||") for example)
+         * @param [in] buffer0 First memory buffer (M0AR)
+         * @param [in] buffer1 Second memory buffer (M1AR)
+         * @param [in] periph Peripheral address
+         * @param [in] bufferSize Size of each buffer
+         * @param [in] channel Channel
+         * @par Returns
+         *	Nothing
+         */
+        static void TransferDoubleBuffer(Mode mode, void* buffer0, void* buffer1, volatile void* periph, uint16_t bufferSize, uint8_t channel = 0);
+
+        /**
+         * @brief Returns index of buffer owned by CPU (not accessed by DMA) in double-buffer mode
+         *
+         * @retval 0 First buffer (M0AR) is idle
+         * @retval 1 Second buffer (M1AR) is idle
+         */
+        static uint8_t IdleBufferIndex();
+
+        /**
+         * @brief Returns buffer owned by CPU (not accessed by DMA) in double-buffer mode
+         *
+         * @returns Idle buffer address
+         */
+        static void* IdleBuffer();
+
+        /**
+         * @brief Replace idle buffer in double-buffer mode
+         *
+         * @details
+         * New buffer is used by DMA after buffer in progress is complete.
+         * Call it from transfer callback (right after buffers are switched): if DMA completes
+         * buffer in progress during update, new address is written to register of buffer in use
+         * and hardware disables stream with transfer error.
+         *
+         * @param [in] buffer New buffer (same size)
+         *
+         * @retval true Buffer was replaced
+         * @retval false DMA switched buffers during update: stream is stopped with error
+         * (transfer callback reports it), restart it with TransferDoubleBuffer
+         */
+        static bool SetIdleBuffer(void* buffer);
+    #endif
+
         /**
          * @brief Set transfer callback function
          *
-         * @par [in] callback Pointer to callback function
+         * @par [in] callback Callback (function, or delegate with bound context)
          *
          * @par Returns
          *	Nothing
@@ -329,6 +433,19 @@ namespace Zhele
          *	Nothing
          */
         static void IrqHandler();
+
+    private:
+        static void Start(Mode mode, const void* buffer, volatile void* periph, uint32_t bufferSize
+        ONLY_IF_STREAM_SUPPORTED(COMMA uint8_t channel));
+        template<typename _Buffer>
+        static uint16_t LoadDescriptor(uint16_t index);
+
+        static inline const void* _descriptors = nullptr;
+        /// Loads first non-empty descriptor from index, returns its index (descriptors count if there is no such)
+        static inline uint16_t (*_loadDescriptor)(uint16_t index) = nullptr;
+        static inline uint16_t _descriptorCount = 0; ///< Zero if descriptor list transfer is not active
+        static inline uint16_t _descriptorIndex = 0;
+        static inline bool _descriptorLoop = false;
     };
 
     /**
@@ -384,6 +501,7 @@ namespace Zhele
         static void ClearChannelFlag();
 
     public:
+        using Regs = _DmaRegs;
         static const int Channels = _Channels;
 
         /**
@@ -0,0 +1,145 @@
+/**
+ * @file
+ * Implements compile-time DMA channel (and DMAMUX request line) allocator
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_DMA_ALLOCATOR_H
+#define ZHELE_PLATFORM_STM32_COMMON_DMA_ALLOCATOR_H
+
+#include <zhele/dma.h>
+#if defined(DMAMUX1)
+    #include <zhele/dmamux.h>
+#endif
+#include <zhele/common/template_utils/type_list.h>
+
+#include <array>
+#include <type_traits>
+
+namespace Zhele
+{
+    /**
+     * @brief DMA user (peripheral request that needs DMA channel)
+     *
+     * @tparam _Request Request: DMAMUX request input on families with DMAMUX,
+     * channel selection (CSELR / SxCR CHSEL value) or any tag otherwise
+     * @tparam _Channel Required DMA channel (void - any free channel from allocator pool)
+     */
+    template<auto _Request, typename _Channel = void>
+    struct DmaUser
+    {
+        static constexpr auto Request = _Request;
+        using Channel = _Channel;
+    };
+
+    /**
+     * @brief Compile-time DMA channel allocator
+     *
+     * @details
+     * Users with required channel get it, other users get first free channels of pool
+     * (in order of users list). Channel claimed twice, DMAMUX request allocated twice or
+     * exhausted pool fail compilation. On families with DMAMUX Init method routes
+     * all requests to allocated channels.
+     *
+     * @par Example
+     * @code
+     * using UsartTx = DmaUser<DmamuxRequestInput::Usart1Tx>;
+     * using SpiTx = DmaUser<DmamuxRequestInput::Spi1Tx, Dma1Channel3>;
+     * using Dma = DmaAllocator<type_list<Dma1Channel1, Dma1Channel2>, type_list<UsartTx, SpiTx>>;
+     *
+     * Dma::Init();
+     * using UsartTxChannel = Dma::Channel<UsartTx>; // Dma1Channel1
+     * @endcode
+     *
+     * @tparam _Pool Type list of DMA channels for automatic allocation
+     * @tparam _Users Type list of DMA users (\ref DmaUser)
+     */
+    template<typename _Pool, typename _Users>
+    class DmaAllocator;
+
+    template<typename... _Pool, typename... _Users>
+    class DmaAllocator<template_utils::type_list<_Pool...>, template_utils::type_list<_Users...>>
+    {
+        using PoolList = template_utils::type_list<_Pool...>;
+        using UserList = template_utils::type_list<_Users...>;
+
+        static constexpr int Fixed = -1;
+        static constexpr int Exhausted = -2;
+
+        /**
+         * @brief Returns how many users require given channel
+         */
+        template<typename _Channel>
+        static consteval unsigned Claims() { return ((std::is_same_v<typename _Users::Channel, _Channel> ? 1u : 0u) + ... + 0u); }
+
+        /**
+         * @brief Returns how many users have given request
+         */
+        template<auto _Request>
+        static consteval unsigned Requests()
+        {
+            return ((std::is_same_v<std::remove_cv_t<decltype(_Users::Request)>, decltype(_Request)> && _Users::Request == _Request ? 1u : 0u) + ... + 0u);
+        }
+
+        /**
+         * @brief Assigns pool channels to users without required channel
+         *
+         * @returns Pool index for each user (Fixed for users with required channel, Exhausted if pool is over)
+         */
+        static consteval std::array<int, sizeof...(_Users)> Assign();
+
+        static constexpr std::array<int, sizeof...(_Users)> Assignment = Assign();
+
+        static_assert(PoolList::is_unique(), "DMA allocator pool contains channel twice");
+        static_assert(((std::is_void_v<typename _Users::Channel> || Claims<typename _Users::Channel>() == 1) && ...), "DMA channel is claimed by several users");
+    #if defined(DMAMUX1)
+        static_assert(((Requests<_Users::Request>() == 1) && ...), "DMA request is allocated twice");
+    #endif
+        static_assert(((Assignment[UserList::template search<_Users>()] != Exhausted) && ...), "DMA allocator pool has no free channel for user");
+
+        template<typename _User>
+        static consteval auto ChannelOf()
+        {
+            constexpr int user = UserList::template search<_User>();
+            static_assert(user >= 0, "DMA user is not registered in allocator");
+
+            if constexpr (!std::is_void_v<typename _User::Channel>)
+                return template_utils::type_box<typename _User::Channel>{};
+            else
+                return PoolList::template get<Assignment[user]>();
+        }
+
+    #if defined(DMAMUX1)
+        template<typename _User>
+        static void Route();
+    #endif
+
+    public:
+        /**
+         * @brief Allocated DMA channel of user
+         *
+         * @tparam _User DMA user
+         */
+        template<typename _User>
+        using Channel = typename decltype(ChannelOf<_User>())::type;
+
+        /**
+         * @brief Enables DMA modules of allocated channels and configures all DMAMUX routes
+         *
+         * @details
+         * Families without DMAMUX have fixed request mapping, so only DMA modules are enabled
+         * (request is passed by user as channel selection argument of Transfer).
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Init();
+    };
+}
+
+#include "impl/dma_allocator.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_DMA_ALLOCATOR_H
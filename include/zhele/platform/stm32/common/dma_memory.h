@@ -0,0 +1,129 @@
+/**
+ * @file
+ * Implements memory copy/fill by DMA (memory-to-memory transfers)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_DMA_MEMORY_H
+#define ZHELE_PLATFORM_STM32_COMMON_DMA_MEMORY_H
+
+#include <zhele/dma.h>
+#include <zhele/common/delegate.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Zhele
+{
+    /**
+     * @brief Memory copy/fill service over reserved DMA channel
+     *
+     * @details
+     * Copy and fill are asynchronous: DMA moves data (with widest item size allowed by
+     * alignment of addresses and size, in chunks of up to 65535 items) while CPU does other work,
+     * completion callback is called from DMA interrupt. Blocks smaller than threshold are copied
+     * (filled) by CPU immediately, because DMA setup and interrupt cost more than copy itself
+     * (see DmaMemoryBenchmark in host benchmarks for crossover point).
+     *
+     * DMA channel must be able to perform memory-to-memory transfers (only DMA2 on F4)
+     * and must not be used by anything else. DMA interrupt handler must call _DmaChannel::IrqHandler.
+     *
+     * @par Example
+     * @code
+     * using Memory = DmaMemory<Dma1Channel1>;
+     * extern "C" void DMA1_Channel1_IRQHandler() { Dma1Channel1::IrqHandler(); }
+     *
+     * Memory::Fill(frameBuffer, 0, sizeof(frameBuffer), onCleared);
+     * @endcode
+     *
+     * @tparam _DmaChannel DMA channel
+     * @tparam _CpuThreshold Default threshold (bytes): smaller blocks are processed by CPU
+     */
+    template<typename _DmaChannel, size_t _CpuThreshold = 64>
+    class DmaMemory
+    {
+    public:
+        using Callback = Delegate<void(bool success)>;
+
+        /**
+         * @brief Copy memory block
+         *
+         * @details
+         * Blocks must not overlap and must be valid until callback is called.
+         * Small block is copied before return (callback is called from this method).
+         *
+         * @param [out] destination Destination
+         * @param [in] source Source
+         * @param [in] size Size (bytes)
+         * @param [in] callback Complete callback (optional parameter)
+         *
+         * @retval true Copy is done or started
+         * @retval false DMA is busy with previous request
+         */
+        static bool Copy(void* destination, const void* source, size_t size, Callback callback = nullptr);
+
+        /**
+         * @brief Fill memory block with byte value
+         *
+         * @details
+         * Block must be valid until callback is called.
+         * Small block is filled before return (callback is called from this method).
+         *
+         * @param [out] destination Destination
+         * @param [in] value Byte value
+         * @param [in] size Size (bytes)
+         * @param [in] callback Complete callback (optional parameter)
+         *
+         * @retval true Fill is done or started
+         * @retval false DMA is busy with previous request
+         */
+        static bool Fill(void* destination, uint8_t value, size_t size, Callback callback = nullptr);
+
+        /**
+         * @brief Check that DMA request is in progress
+         *
+         * @retval true DMA is busy
+         * @retval false DMA is idle
+         */
+        static bool Busy();
+
+        /**
+         * @brief Set threshold
+         *
+         * @param [in] threshold Size (bytes): smaller blocks are processed by CPU
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void SetThreshold(size_t threshold);
+
+        /**
+         * @brief Returns threshold
+         *
+         * @returns Size (bytes): smaller blocks are processed by CPU
+         */
+        static size_t Threshold();
+
+    private:
+        static bool Start(uint8_t* destination, const uint8_t* source, size_t size, Callback callback);
+        static void StartChunk();
+        static void Finish(bool success);
+        static void TransferCompleted(void* data, unsigned size, bool success);
+
+        static inline uint8_t* _destination = nullptr;
+        static inline const uint8_t* _source = nullptr; ///< Nullptr for fill
+        static inline size_t _remaining = 0;
+        static inline size_t _chunk = 0; ///< Bytes count of current DMA transfer
+        static inline uint32_t _pattern = 0; ///< Fill value (source of fill transfer)
+        static inline Callback _callback = nullptr;
+        static inline volatile bool _busy = false;
+        static inline size_t _threshold = _CpuThreshold;
+    };
+} // namespace Zhele
+
+#include "impl/dma_memory.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_DMA_MEMORY_H
@@ -0,0 +1,1606 @@
+/**
+ * @file
+ * Peripheral models for host build (ZHELE_HOST_REGISTERS)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_HOST_MODELS_H
+#define ZHELE_PLATFORM_STM32_COMMON_HOST_MODELS_H
+
+#if !defined(ZHELE_HOST_REGISTERS)
+    #error "Zhele: peripheral models are available only in host build (ZHELE_HOST_REGISTERS)"
+#endif
+
+#include <zhele/common/host/register_file.h>
+#include <zhele/dma.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace Zhele::Host
+{
+    /**
+     * @brief GPIO port model
+     *
+     * @details
+     * Applies BSRR/BRR writes to ODR, IDR mirrors ODR (loopback).
+     */
+    class GpioPortModel : public PeripheralModel
+    {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * @param [in] regs Port registers (GPIOA, GPIOB...)
+         */
+        GpioPortModel(GPIO_TypeDef* regs)
+            : _regs(regs)
+        {
+            RegisterFile::Attach(*this, AddressOf(regs), sizeof(GPIO_TypeDef));
+        }
+
+        ~GpioPortModel() override
+        {
+            RegisterFile::Detach(*this);
+        }
+
+        void Step() override
+        {
+            uint32_t bsrr = _regs->BSRR;
+            if(bsrr != 0)
+            {
+                _regs->ODR = (_regs->ODR & ~(bsrr >> 16)) | (bsrr & 0xffff);
+                _regs->BSRR = 0;
+            }
+            ApplyBrr(_regs);
+            _regs->IDR = _regs->ODR;
+        }
+
+    private:
+        // Template to discard BRR access on families without BRR register (F4)
+        template<typename _Regs>
+        static void ApplyBrr(_Regs* regs)
+        {
+            if constexpr (requires { regs->BRR; })
+            {
+                if(regs->BRR != 0)
+                {
+                    regs->ODR &= ~regs->BRR;
+                    regs->BRR = 0;
+                }
+            }
+        }
+
+        GPIO_TypeDef* _regs;
+    };
+
+    /**
+     * @brief Reset and clock control model
+     *
+     * @details
+     * Oscillator ready flags follow enable bits (start-up takes one step), system clock switch
+     * status follows selected source. Switch status is polled by SysClock::SelectClockSource without
+     * register wrapper, so it is updated at next wrapped access to RCC.
+     */
+    class RccModel : public PeripheralModel
+    {
+    public:
+        RccModel()
+        {
+            RegisterFile::Attach(*this, AddressOf(RCC), sizeof(RCC_TypeDef));
+        }
+
+        ~RccModel() override
+        {
+            RegisterFile::Detach(*this);
+        }
+
+        void Step() override
+        {
+            uint32_t cr = RCC->CR;
+            cr = Follow(cr, RCC_CR_HSION, RCC_CR_HSIRDY);
+            cr = Follow(cr, RCC_CR_HSEON, RCC_CR_HSERDY);
+        #if defined(RCC_CR_PLLON)
+            cr = Follow(cr, RCC_CR_PLLON, RCC_CR_PLLRDY);
+        #endif
+            RCC->CR = cr;
+
+            uint32_t cfgr = RCC->CFGR;
+            RCC->CFGR = (cfgr & ~RCC_CFGR_SWS) | ((cfgr & RCC_CFGR_SW) << RCC_CFGR_SWS_Pos);
+        }
+
+    private:
+        static uint32_t Follow(uint32_t cr, uint32_t enable, uint32_t ready)
+        {
+            return (cr & enable) ? (cr | ready) : (cr & ~ready);
+        }
+    };
+
+    /**
+     * @brief Core cycle counter model (DWT CYCCNT or SysTick, see CycleCounter)
+     *
+     * @details
+     * Host has no core clock, so model charges fixed cycles count for each register access
+     * (peripheral or core register): counter advances only when code under test touches registers.
+     * Polling loops read counter, so waits for cycle counter finish. Instructions between accesses
+     * are free, so cycles counted by model are lower bound of MCU cycles.
+     */
+    class CycleCounterModel : public PeripheralModel
+    {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * @param [in] accessCycles Cycles per register access
+         */
+        CycleCounterModel(uint32_t accessCycles = 2)
+            : _accessCycles(accessCycles)
+        {
+            RegisterFile::Attach(*this, 0x40000000, 0x00080000);
+            RegisterFile::Attach(*this, 0x50000000, 0x00080000);
+            RegisterFile::Attach(*this, 0xe0000000, 0x00100000);
+        }
+
+        ~CycleCounterModel() override
+        {
+            RegisterFile::Detach(*this);
+        }
+
+        /**
+         * @brief Returns cycles counted since reset (not limited by counter width)
+         *
+         * @returns Cycles count
+         */
+        uint64_t Cycles() const
+        {
+            return _cycles;
+        }
+
+        void Reset() override
+        {
+            _cycles = 0;
+            _prescaler = 0;
+        }
+
+        void Step() override
+        {
+            _cycles += _accessCycles;
+        #if defined(DWT_CTRL_CYCCNTENA_Msk)
+            if(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)
+                DWT->CYCCNT += _accessCycles;
+        #else
+            if(SysTick->CTRL & SysTick_CTRL_ENABLE_Msk)
+            {
+                // HCLK/8 clock source (CLKSOURCE = 0): one tick per 8 cycles
+                uint32_t ticks = _accessCycles;
+                if(!(SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk))
+                {
+                    _prescaler += _accessCycles;
+                    ticks = _prescaler / 8;
+                    _prescaler %= 8;
+                }
+                uint32_t period = SysTick->LOAD + 1;
+                SysTick->VAL = (SysTick->VAL + period - ticks % period) % period;
+            }
+        #endif
+        }
+
+    private:
+        uint32_t _accessCycles;
+        uint64_t _cycles = 0;
+        uint32_t _prescaler = 0;
+    };
+
+    /**
+     * @brief Timer counter model
+     *
+     * @details
+     * Counter is advanced by test (Advance method), so test controls time exactly. Prescaler is not modeled:
+     * one tick is one counter step. Model counts up to ARR, sets UIF on overflow, CCxIF on compare match
+     * (output channels) and on input edge (Capture method), emulates write-zero-to-clear status register
+     * and raises interrupt handler (at event time) when flag is set and enabled in DIER.
+     */
+    class TimerModel : public PeripheralModel
+    {
+        static constexpr uint32_t InterruptFlags = TIM_SR_UIF | TIM_SR_CC1IF | TIM_SR_CC2IF | TIM_SR_CC3IF | TIM_SR_CC4IF;
+    public:
+        using IrqHandler = std::add_pointer_t<void()>;
+
+        /**
+         * @brief Constructor
+         *
+         * @param [in] regs Timer registers (TIM2, TIM3...)
+         * @param [in] irqHandler Interrupt handler (same as in vector table)
+         */
+        TimerModel(TIM_TypeDef* regs, IrqHandler irqHandler = nullptr)
+            : _regs(regs)
+            , _irqHandler(irqHandler)
+        {
+            RegisterFile::Attach(*this, AddressOf(regs), sizeof(TIM_TypeDef));
+        }
+
+        ~TimerModel() override
+        {
+            RegisterFile::Detach(*this);
+        }
+
+        /**
+         * @brief Advance counter (does nothing if counter is disabled)
+         *
+         * @param [in] ticks Counter steps
+         *
+         * @par Returns
+         *	Nothing
+         */
+        void Advance(uint64_t ticks)
+        {
+            while(ticks != 0 && (_regs->CR1 & TIM_CR1_CEN))
+                ticks -= AdvanceToEvent(ticks);
+        }
+
+        /**
+         * @brief Advance counter to nearest event (overflow or compare match) but not more than limit
+         *
+         * @details
+         * Used by wait handler of low-power tests: core sleeps until timer event.
+         *
+         * @param [in] limit Max counter steps
+         *
+         * @returns Counter steps made (zero if counter is disabled)
+         */
+        uint64_t AdvanceToEvent(uint64_t limit)
+        {
+            if(limit == 0 || !(_regs->CR1 & TIM_CR1_CEN))
+                return 0;
+
+            uint32_t period = _regs->ARR + 1;
+            uint32_t counter = _regs->CNT;
+
+            // Jump to nearest event: overflow or compare match
+            uint64_t step = std::min<uint64_t>(limit, period - counter);
+            for(unsigned channel = 0; channel < 4; ++channel)
+            {
+                uint32_t compare = (&_regs->CCR1)[channel];
+                if(IsOutput(channel) && compare > counter && compare - counter < step)
+                    step = compare - counter;
+            }
+            counter += step;
+            _ticks += step;
+
+            if(counter >= period)
+            {
+                counter = 0;
+                _flags |= TIM_SR_UIF;
+            }
+            _regs->CNT = counter;
+            for(unsigned channel = 0; channel < 4; ++channel)
+            {
+                if(IsOutput(channel) && (&_regs->CCR1)[channel] == counter)
+                    _flags |= TIM_SR_CC1IF << channel;
+            }
+            Update();
+            RegisterFile::Step();
+            return step;
+        }
+
+        /**
+         * @brief Emulate input edge on capture channel
+         *
+         * @details
+         * Counter is latched to capture register, capture flag is set. In slave reset mode
+         * counter is reset after capture (as by TI1 edge trigger). DMA request is not modeled:
+         * call DmaChannelModel::Request before edge, so DMA moves captured value on step.
+         *
+         * @param [in] channel Channel number (0..3)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        void Capture(unsigned channel)
+        {
+            (&_regs->CCR1)[channel] = _regs->CNT;
+            _flags |= TIM_SR_CC1IF << channel;
+            if((_regs->SMCR & TIM_SMCR_SMS) == TIM_SMCR_SMS_2)
+            {
+                _regs->CNT = 0;
+                _flags |= TIM_SR_UIF;
+            }
+            Update();
+            RegisterFile::Step();
+        }
+
+        /**
+         * @brief Returns ticks counted since reset
+         *
+         * @returns Ticks count
+         */
+        uint64_t Ticks() const
+        {
+            return _ticks;
+        }
+
+        /**
+         * @brief Returns count of raised interrupts
+         *
+         * @returns Interrupts count
+         */
+        uint32_t Interrupts() const
+        {
+            return _interrupts;
+        }
+
+        void Reset() override
+        {
+            _flags = 0;
+            _pending = 0;
+            _ticks = 0;
+            _interrupts = 0;
+        }
+
+        void Step() override
+        {
+            // Flags are cleared by writing zero, ones written to status register are ignored
+            _flags &= _regs->SR;
+            // Update generation reinitializes counter
+            if(_regs->EGR & TIM_EGR_UG)
+            {
+                _regs->EGR = 0;
+                _regs->CNT = 0;
+                _flags |= TIM_SR_UIF;
+            }
+            Update();
+        }
+
+    private:
+        bool IsOutput(unsigned channel) const
+        {
+            // CCxS bits are zero for output compare channel
+            uint32_t mode = channel < 2 ? _regs->CCMR1 : _regs->CCMR2;
+            return ((mode >> ((channel & 1) * 8)) & TIM_CCMR1_CC1S) == 0;
+        }
+
+        void Update()
+        {
+            _regs->SR = _flags;
+
+            // Interrupt is raised when enabled flag appears (pending flag has been raised already)
+            uint32_t pending = _flags & _regs->DIER & InterruptFlags;
+            if((pending & ~_pending) != 0 && _irqHandler != nullptr)
+            {
+                ++_interrupts;
+                RegisterFile::Raise(_irqHandler);
+            }
+            _pending = pending;
+        }
+
+        TIM_TypeDef* _regs;
+        IrqHandler _irqHandler;
+        uint32_t _flags = 0;
+        uint32_t _pending = 0;
+        uint64_t _ticks = 0;
+        uint32_t _interrupts = 0;
+    };
+
+    /**
+     * @brief I2C slave memory device on GPIO pins (for software I2C)
+     *
+     * @details
+     * Model follows SCL/SDA levels written by master to ODR (port model must be attached
+     * before this one) and drives SDA low in IDR for acknowledge and data bits. Memory semantics
+     * are the same as I2cDeviceModel has: first written byte sets memory pointer, next bytes
+     * are stored, read bytes are taken from memory. Model sees one pin change per step
+     * (each pin write is followed by other access before next write), clock stretching is not modeled.
+     *
+     * @tparam _SclPin SCL pin
+     * @tparam _SdaPin SDA pin (on the same port)
+     */
+    template<typename _SclPin, typename _SdaPin>
+    class I2cPinsDeviceModel : public PeripheralModel
+    {
+        static_assert(std::is_same_v<typename _SclPin::Port, typename _SdaPin::Port>, "SCL and SDA must be on the same port");
+
+        enum class State : uint8_t
+        {
+            Idle,
+            Receive,
+            Acknowledge,
+            Transmit,
+            MasterAcknowledge,
+        };
+    public:
+        uint8_t Memory[256] {}; ///< Device memory
+
+        /**
+         * @brief Constructor
+         *
+         * @param [in] address Device address (7-bit)
+         */
+        I2cPinsDeviceModel(uint8_t address)
+            : _regs(_SclPin::Port::Regs::Get())
+            , _address(address)
+        {
+            RegisterFile::Attach(*this, AddressOf(_regs), sizeof(GPIO_TypeDef));
+        }
+
+        ~I2cPinsDeviceModel() override
+        {
+            RegisterFile::Detach(*this);
+        }
+
+        /**
+         * @brief Returns count of received start conditions (including repeated) since reset
+         *
+         * @returns Start conditions count
+         */
+        uint32_t Starts() const
+        {
+            return _starts;
+        }
+
+        void Reset() override
+        {
+            _state = State::Idle;
+            _scl = true;
+            _sda = true;
+            _release = true;
+            _starts = 0;
+        }
+
+        void Step() override
+        {
+            bool scl = _regs->ODR & (1u << _SclPin::Number);
+            bool sda = (_regs->ODR & (1u << _SdaPin::Number)) && _release;
+
+            if(_scl && scl && _sda != sda)
+                Condition(!sda);
+            else if(!_scl && scl)
+                Rising(sda);
+            else if(_scl && !scl)
+                Falling();
+
+            _scl = scl;
+            _sda = (_regs->ODR & (1u << _SdaPin::Number)) && _release;
+            if(_sda)
+                _regs->IDR |= 1u << _SdaPin::Number;
+            else
+                _regs->IDR &= ~(1u << _SdaPin::Number);
+        }
+
+    private:
+        void Condition(bool start)
+        {
+            _release = true;
+            if(start)
+            {
+                _state = State::Receive;
+                _bits = 0;
+                _addressed = false;
+                _pointerSet = false;
+                ++_starts;
+            }
+            else
+            {
+                _state = State::Idle;
+            }
+        }
+
+        void Rising(bool sda)
+        {
+            if(_state == State::Receive)
+            {
+                _shift = (_shift << 1) | sda;
+                ++_bits;
+            }
+            else if(_state == State::MasterAcknowledge)
+            {
+                _masterAck = !sda;
+            }
+        }
+
+        void Falling()
+        {
+            switch(_state)
+            {
+            case State::Receive:
+                if(_bits < 8)
+                    break;
+                if(!_addressed)
+                {
+                    if((_shift >> 1) != _address)
+                    {
+                        _state = State::Idle;
+                        break;
+                    }
+                    _read = _shift & 1;
+                }
+                else if(!_pointerSet)
+                {
+                    _pointer = _shift;
+                    _pointerSet = true;
+                }
+                else
+                {
+                    Memory[_pointer++] = _shift;
+                }
+                _state = State::Acknowledge;
+                _release = false;
+                break;
+            case State::Acknowledge:
+                _release = true;
+                if(!_addressed && _read)
+                {
+                    StartTransmit();
+                }
+                else
+                {
+                    _state = State::Receive;
+                    _bits = 0;
+                }
+                _addressed = true;
+                break;
+            case State::Transmit:
+                if(_bits < 8)
+                {
+                    _release = (_shift >> (7 - _bits)) & 1;
+                    ++_bits;
+                }
+                else
+                {
+                    _release = true;
+                    _state = State::MasterAcknowledge;
+                }
+                break;
+            case State::MasterAcknowledge:
+                if(_masterAck)
+                    StartTransmit();
+                else
+                    _state = State::Idle;
+                break;
+            default:
+                break;
+            }
+        }
+
+        void StartTransmit()
+        {
+            _state = State::Transmit;
+            _shift = Memory[_pointer++];
+            _release = _shift >> 7;
+            _bits = 1;
+        }
+
+        GPIO_TypeDef* _regs;
+        uint8_t _address;
+        State _state = State::Idle;
+        bool _scl = true;
+        bool _sda = true;
+        bool _release = true; ///< Device doesn't drive SDA low
+        bool _addressed = false;
+        bool _read = false;
+        bool _pointerSet = false;
+        bool _masterAck = false;
+        uint8_t _bits = 0;
+        uint8_t _shift = 0;
+        uint8_t _pointer = 0;
+        uint32_t _starts = 0;
+    };
+
+    /**
+     * @brief DMA channel (stream) model
+     *
+     * @details
+     * Mem2Periph and Mem2Mem transfers are executed at once on first step after enabling.
+     * Periph2Mem transfers (and Mem2Periph transfers of paced model) are paced by peripheral:
+     * model moves only requested (see Request method) count of data items. Model sets HT/TC flags, handles IFCR writes,
+     * supports circular and double-buffer modes and calls interrupt handler (channel IrqHandler by default)
+     * if interrupts are enabled. In double-buffer mode write to address register of buffer in use
+     * disables stream and sets TE flag (as hardware does).
+     *
+     * @tparam _DmaChannel DMA channel (Dma1Channel1, Dma2Stream7...)
+     */
+    template<typename _DmaChannel>
+    class DmaChannelModel : public PeripheralModel
+    {
+        using ChannelRegs = typename _DmaChannel::Regs;
+        using ModuleRegs = typename _DmaChannel::Module::Regs;
+        static constexpr unsigned Channel = _DmaChannel::Channel;
+    public:
+        using IrqHandler = std::add_pointer_t<void()>;
+
+        /**
+         * @brief Constructor
+         *
+         * @param [in] irqHandler Interrupt handler (same as in vector table)
+         * @param [in] pacedTransmit Mem2Periph transfer is paced by peripheral model requests
+         */
+        DmaChannelModel(IrqHandler irqHandler = _DmaChannel::IrqHandler, bool pacedTransmit = false)
+            : _irqHandler(irqHandler)
+            , _pacedTransmit(pacedTransmit)
+        {
+            uintptr_t moduleBase = AddressOf(ModuleRegs::Get());
+            uintptr_t channelEnd = AddressOf(ChannelRegs::Get()) + sizeof(typename ChannelRegs::DataT);
+            RegisterFile::Attach(*this, moduleBase, channelEnd - moduleBase);
+        }
+
+        ~DmaChannelModel() override
+        {
+            RegisterFile::Detach(*this);
+        }
+
+        /**
+         * @brief Request data items from peripheral (Periph2Mem transfers)
+         *
+         * @param [in] count Items count
+         *
+         * @par Returns
+         *	Nothing
+         */
+        void Request(uint32_t count)
+        {
+            _requests += count;
+        }
+
+        /**
+         * @brief Returns count of items moved since reset
+         *
+         * @returns Items count
+         */
+        uint32_t Transferred() const
+        {
+            return _transferred;
+        }
+
+        void Reset() override
+        {
+            _active = false;
+            _requests = 0;
+            _transferred = 0;
+        }
+
+        void Step() override
+        {
+            auto channel = ChannelRegs::Get();
+            auto module = ModuleRegs::Get();
+
+        #if defined(DMA_CCR_EN)
+            module->ISR &= ~module->IFCR;
+            module->IFCR = 0;
+
+            volatile uint32_t& control = channel->CCR;
+            volatile uint32_t& counter = channel->CNDTR;
+            uint32_t memory = channel->CMAR;
+            uint32_t periph = channel->CPAR;
+
+            bool enabled = control & DMA_CCR_EN;
+            bool memToPeriph = control & DMA_CCR_DIR;
+            bool memToMem = control & DMA_CCR_MEM2MEM;
+            bool circular = control & DMA_CCR_CIRC;
+            bool memIncrement = control & DMA_CCR_MINC;
+            bool periphIncrement = control & DMA_CCR_PINC;
+            unsigned memSize = 1u << ((control & DMA_CCR_MSIZE) >> DMA_CCR_MSIZE_Pos);
+            unsigned periphSize = 1u << ((control & DMA_CCR_PSIZE) >> DMA_CCR_PSIZE_Pos);
+            bool interrupts = control & (DMA_CCR_TCIE | DMA_CCR_HTIE);
+        #endif
+        #if defined(DMA_SxCR_EN)
+            module->LISR &= ~module->LIFCR;
+            module->HISR &= ~module->HIFCR;
+            module->LIFCR = 0;
+            module->HIFCR = 0;
+
+            volatile uint32_t& control = channel->CR;
+            volatile uint32_t& counter = channel->NDTR;
+            bool doubleBuffer = control & DMA_SxCR_DBM;
+            uint32_t memory = (doubleBuffer && (control & DMA_SxCR_CT)) ? channel->M1AR : channel->M0AR;
+            uint32_t periph = channel->PAR;
+
+            bool enabled = control & DMA_SxCR_EN;
+            bool memToPeriph = (control & DMA_SxCR_DIR) == DMA_SxCR_DIR_0;
+            bool memToMem = (control & DMA_SxCR_DIR) == DMA_SxCR_DIR_1;
+            bool circular = (control & DMA_SxCR_CIRC) || doubleBuffer;
+            bool memIncrement = control & DMA_SxCR_MINC;
+            bool periphIncrement = control & DMA_SxCR_PINC;
+            unsigned memSize = 1u << ((control & DMA_SxCR_MSIZE) >> DMA_SxCR_MSIZE_Pos);
+            unsigned periphSize = 1u << ((control & DMA_SxCR_PSIZE) >> DMA_SxCR_PSIZE_Pos);
+            bool interrupts = control & (DMA_SxCR_TCIE | DMA_SxCR_HTIE);
+        #endif
+
+            if(!enabled)
+            {
+                _active = false;
+                return;
+            }
+
+        #if defined(DMA_SxCR_EN)
+            // Write to address register of buffer in use disables stream with transfer error
+            if(_active && doubleBuffer && (control & DMA_SxCR_CT) == _target && memory != _memory)
+            {
+                _active = false;
+                control &= ~DMA_SxCR_EN;
+                SetFlags(TransferErrorFlag);
+                if(control & DMA_SxCR_TEIE)
+                    _irqHandler();
+                return;
+            }
+            _target = control & DMA_SxCR_CT;
+        #endif
+
+            if(!_active || counter != _remaining || memory != _memory)
+            {
+                _active = true;
+                _total = counter;
+                _remaining = counter;
+                _memory = memory;
+                _index = 0;
+            }
+
+            if(_remaining == 0)
+                return;
+
+            bool paced = !memToMem && (!memToPeriph || _pacedTransmit);
+            uint32_t count = paced
+                ? std::min(_requests, _remaining)
+                : _remaining;
+            if(count == 0)
+                return;
+            if(paced)
+                _requests -= count;
+
+            bool halfBefore = _remaining > _total / 2;
+            for(uint32_t i = 0; i < count; ++i)
+            {
+                uint32_t memAddress = memory + (memIncrement ? _index * memSize : 0);
+                uint32_t periphAddress = periph + (periphIncrement ? _index * periphSize : 0);
+
+                uint32_t value = 0;
+                if(memToPeriph)
+                {
+                    std::memcpy(&value, reinterpret_cast<const void*>(memAddress), memSize);
+                    std::memcpy(reinterpret_cast<void*>(periphAddress), &value, periphSize);
+                }
+                else
+                {
+                    std::memcpy(&value, reinterpret_cast<const void*>(periphAddress), periphSize);
+                    std::memcpy(reinterpret_cast<void*>(memAddress), &value, memSize);
+                }
+
+                if(++_index == _total)
+                    _index = 0;
+            }
+            _transferred += count;
+            _remaining -= count;
+
+            uint32_t flags = 0;
+            if(halfBefore && _remaining <= _total / 2)
+                flags |= HalfTransferFlag;
+            if(_remaining == 0)
+            {
+                flags |= TransferCompleteFlag;
+                if(circular)
+                    _remaining = _total;
+            #if defined(DMA_SxCR_EN)
+                // Switch to other buffer
+                if(doubleBuffer)
+                {
+                    control ^= DMA_SxCR_CT;
+                    _target = control & DMA_SxCR_CT;
+                    _memory = _target ? channel->M1AR : channel->M0AR;
+                }
+            #endif
+            }
+            counter = _remaining;
+            SetFlags(flags);
+
+            if(flags != 0 && interrupts)
+            {
+                if(_remaining == 0)
+                    _active = false;
+                _irqHandler();
+            }
+        }
+
+    private:
+    #if defined(DMA_CCR_EN)
+        static constexpr uint32_t HalfTransferFlag = DMA_ISR_HTIF1 | DMA_ISR_GIF1;
+        static constexpr uint32_t TransferCompleteFlag = DMA_ISR_TCIF1 | DMA_ISR_GIF1;
+
+        static void SetFlags(uint32_t flags)
+        {
+            ModuleRegs::Get()->ISR |= flags << ((Channel - 1) * 4);
+        }
+    #endif
+    #if defined(DMA_SxCR_EN)
+        static constexpr uint32_t HalfTransferFlag = DMA_LISR_HTIF0;
+        static constexpr uint32_t TransferCompleteFlag = DMA_LISR_TCIF0;
+        static constexpr uint32_t TransferErrorFlag = DMA_LISR_TEIF0;
+
+        static void SetFlags(uint32_t flags)
+        {
+            constexpr unsigned offsets[] = {0, 6, 16, 22};
+            if constexpr (Channel < 4)
+                ModuleRegs::Get()->LISR |= flags << offsets[Channel];
+            else
+                ModuleRegs::Get()->HISR |= flags << offsets[Channel - 4];
+        }
+    #endif
+
+        IrqHandler _irqHandler;
+        bool _pacedTransmit;
+        bool _active = false;
+        uint32_t _total = 0;
+        uint32_t _remaining = 0;
+        uint32_t _memory = 0;
+        uint32_t _index = 0;
+        uint32_t _requests = 0;
+        uint32_t _transferred = 0;
+    #if defined(DMA_SxCR_EN)
+        uint32_t _target = 0;
+    #endif
+    };
+#if defined(I2C_SR2_BUSY)
+    /**
+     * @brief I2C bus model (SR1/SR2 registers layout) with one slave memory device
+     *
+     * @details
+     * First byte written to device sets memory pointer, next written bytes are stored to memory,
+     * read bytes are taken from memory (pointer is incremented). Every bus byte (address or data)
+     * takes byteSteps model steps, so polling code spends steps on status reads while interrupt
+     * driven code leaves them to other work.
+     *
+     * Model can't see register reads, so flags cleared by reads are cleared by time:
+     * ADDR (SR1 then SR2 read) and RXNE (DR read) are cleared 3 steps after set, bus is stretched
+     * until then. With POS set RXNE stays set: next byte waits in shift register with BTF set,
+     * code sets STOP and reads DR twice (second read gets shift register). Data written by CPU
+     * is detected by DR value: model sets DR to Empty when it takes data register content. Event and error interrupts are raised by
+     * RegisterFile::Raise. DMA requests are served by paced DMA channel models, RX DMA model
+     * must raise its interrupt by RegisterFile::Raise too.
+     *
+     * @tparam _I2c I2C (I2c1, I2c2...)
+     */
+    template<typename _I2c>
+    class I2cDeviceModel : public PeripheralModel
+    {
+        using Regs = typename _I2c::Regs;
+        using TxDmaModel = DmaChannelModel<typename _I2c::DmaTx>;
+        using RxDmaModel = DmaChannelModel<typename _I2c::DmaRx>;
+        static constexpr bool HasDma = !std::is_same_v<typename _I2c::DmaTx, void> && !std::is_same_v<typename _I2c::DmaRx, void>;
+
+        enum class State : uint8_t
+        {
+            Idle,
+            Start,
+            Address,
+            AddressShift,
+            Transmit,
+            Receive,
+            Nacked,
+        };
+
+        static constexpr unsigned StartSteps = 2;
+        static constexpr unsigned ClearSteps = 3;
+        static constexpr uint32_t Events = I2C_SR1_SB | I2C_SR1_ADDR | I2C_SR1_BTF;
+        static constexpr uint32_t BufferEvents = I2C_SR1_TXE | I2C_SR1_RXNE;
+        static constexpr uint32_t Errors = I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR;
+    public:
+        static constexpr uint32_t Empty = 0x100; ///< DR value after model takes written byte
+
+        uint8_t Memory[256] {}; ///< Device memory
+
+        /**
+         * @brief Constructor
+         *
+         * @param [in] address Device address (7-bit)
+         * @param [in] byteSteps Model steps per bus byte
+         * @param [in] dmaTx Paced TX DMA model (optional parameter)
+         * @param [in] dmaRx Paced RX DMA model (optional parameter)
+         */
+        I2cDeviceModel(uint8_t address, unsigned byteSteps = 9, TxDmaModel* dmaTx = nullptr, RxDmaModel* dmaRx = nullptr)
+            : _address(address)
+            , _byteSteps(byteSteps)
+            , _dmaTx(dmaTx)
+            , _dmaRx(dmaRx)
+        {
+            RegisterFile::Attach(*this, AddressOf(Regs::Get()), sizeof(typename Regs::DataT));
+        }
+
+        ~I2cDeviceModel() override
+        {
+            RegisterFile::Detach(*this);
+        }
+
+        /**
+         * @brief Returns count of raised interrupts (event and error) since reset
+         *
+         * @returns Interrupts count
+         */
+        uint32_t Interrupts() const
+        {
+            return _interrupts;
+        }
+
+        /**
+         * @brief Returns count of steps while bus was busy since reset
+         *
+         * @returns Steps count
+         */
+        uint32_t BusSteps() const
+        {
+            return _busSteps;
+        }
+
+        void Reset() override
+        {
+            _state = State::Idle;
+            _status = 0;
+            _master = 0;
+            _shifting = false;
+            _addrClear = 0;
+            _rxneClear = 0;
+            _nackNext = false;
+            _held = false;
+            _release = false;
+            _enabled = 0;
+            _errorsEnabled = 0;
+            _interrupts = 0;
+            _busSteps = 0;
+        }
+
+        void Step() override
+        {
+            auto regs = Regs::Get();
+            uint32_t control = regs->CR1;
+            uint32_t interrupts = regs->CR2;
+            _raised = 0;
+
+            // Error flags are cleared by writing zero
+            _status &= regs->SR1 | ~Errors;
+
+            if(!(control & I2C_CR1_PE))
+            {
+                Reset();
+                Publish(regs, interrupts);
+                return;
+            }
+
+            if(_state != State::Idle)
+                ++_busSteps;
+
+            if(_addrClear != 0 && --_addrClear == 0)
+                _status &= ~I2C_SR1_ADDR;
+            if(_rxneClear != 0 && --_rxneClear == 0)
+                _status &= ~I2C_SR1_RXNE;
+            if(_release)
+            {
+                // Second DR read after STOP
+                regs->DR = _shift;
+                _held = false;
+                _release = false;
+                _rxneClear = ClearSteps;
+            }
+            if(_state == State::Transmit && regs->DR != Empty)
+                _status &= ~(I2C_SR1_TXE | I2C_SR1_BTF);
+
+            switch(_state)
+            {
+            case State::Start:
+                if(--_countdown == 0)
+                {
+                    Set(I2C_SR1_SB);
+                    _master = I2C_SR2_MSL | I2C_SR2_BUSY;
+                    regs->CR1 &= ~I2C_CR1_START;
+                    control &= ~I2C_CR1_START;
+                    _state = State::Address;
+                }
+                break;
+            case State::Address:
+                if(regs->DR != Empty)
+                {
+                    _shift = regs->DR;
+                    regs->DR = Empty;
+                    _status &= ~I2C_SR1_SB;
+                    _countdown = _byteSteps;
+                    _state = State::AddressShift;
+                }
+                break;
+            case State::AddressShift:
+                if(--_countdown == 0)
+                    AddressReceived();
+                break;
+            case State::Transmit:
+                Transmit(regs, interrupts);
+                break;
+            case State::Receive:
+                Receive(regs, control, interrupts);
+                break;
+            default:
+                break;
+            }
+
+            // STOP and repeated START are generated on byte boundary
+            bool boundary = _state == State::Idle || _state == State::Address || _state == State::Nacked
+                || (_state == State::Transmit && !_shifting);
+            if((control & I2C_CR1_STOP) && boundary)
+            {
+                // Received byte stays in DR until it is read
+                _state = State::Idle;
+                _status &= Errors | I2C_SR1_RXNE;
+                _master = 0;
+                _release = _held;
+                regs->CR1 &= ~I2C_CR1_STOP;
+                control &= ~I2C_CR1_STOP;
+            }
+            if((control & I2C_CR1_START) && boundary)
+            {
+                _state = State::Start;
+                _countdown = StartSteps;
+                _status &= Errors;
+                _shifting = false;
+                _addrClear = 0;
+                _rxneClear = 0;
+                regs->DR = Empty;
+            }
+
+            Publish(regs, interrupts);
+        }
+
+    private:
+        void Set(uint32_t flags)
+        {
+            _raised |= flags & ~_status;
+            _status |= flags;
+        }
+
+        void AddressReceived()
+        {
+            if((_shift >> 1) != _address)
+            {
+                Set(I2C_SR1_AF);
+                _state = State::Nacked;
+                return;
+            }
+
+            Set(I2C_SR1_ADDR);
+            _addrClear = ClearSteps;
+            if(_shift & 1)
+            {
+                _nackNext = false;
+                _master &= ~I2C_SR2_TRA;
+                _countdown = _byteSteps;
+                _state = State::Receive;
+            }
+            else
+            {
+                _master |= I2C_SR2_TRA;
+                _pointerSet = false;
+                Set(I2C_SR1_TXE);
+                _state = State::Transmit;
+            }
+        }
+
+        void Transmit(auto regs, uint32_t interrupts)
+        {
+            // Clock is stretched until ADDR is cleared
+            if(_status & I2C_SR1_ADDR)
+                return;
+
+            bool finished = false;
+            if(_shifting)
+            {
+                if(--_countdown != 0)
+                    return;
+
+                _shifting = false;
+                finished = true;
+                if(_pointerSet)
+                {
+                    Memory[_pointer++] = static_cast<uint8_t>(_shift);
+                }
+                else
+                {
+                    _pointer = static_cast<uint8_t>(_shift);
+                    _pointerSet = true;
+                }
+            }
+
+            // DMA writes one byte, so DR is cleared to tell it from Empty
+            bool requested = false;
+            if constexpr(HasDma)
+            {
+                if(regs->DR == Empty && (interrupts & I2C_CR2_DMAEN) && _dmaTx != nullptr && _I2c::DmaTx::RemainingTransfers() > 0)
+                {
+                    regs->DR = 0;
+                    _dmaTx->Request(1);
+                    _dmaTx->Step();
+                    requested = true;
+                }
+            }
+
+            if(requested || regs->DR != Empty)
+            {
+                _shift = regs->DR;
+                regs->DR = Empty;
+                _shifting = true;
+                _countdown = _byteSteps;
+                Set(I2C_SR1_TXE);
+            }
+            else if(finished)
+            {
+                Set(I2C_SR1_BTF);
+            }
+        }
+
+        void Receive(auto regs, uint32_t control, uint32_t interrupts)
+        {
+            // Clock is stretched until ADDR is cleared and received byte is read
+            // (with POS until next byte is received to shift register)
+            bool pipelined = (control & I2C_CR1_POS) && !_held;
+            if((_status & I2C_SR1_ADDR) || ((_status & I2C_SR1_RXNE) && !pipelined) || --_countdown != 0)
+                return;
+
+            bool dma = false;
+            bool last = !(control & I2C_CR1_ACK);
+            if(control & I2C_CR1_POS)
+            {
+                // ACK bit applies to next byte
+                last = _nackNext;
+                _nackNext = !(control & I2C_CR1_ACK);
+            }
+            if constexpr(HasDma)
+            {
+                uint32_t remaining = _I2c::DmaRx::RemainingTransfers();
+                dma = (interrupts & I2C_CR2_DMAEN) && _dmaRx != nullptr && remaining > 0;
+                last = last || (dma && (interrupts & I2C_CR2_LAST) && remaining == 1);
+            }
+
+            if(_status & I2C_SR1_RXNE)
+            {
+                _shift = Memory[_pointer++];
+                _held = true;
+                Set(I2C_SR1_BTF);
+            }
+            else
+            {
+                regs->DR = Memory[_pointer++];
+            }
+
+            if(dma)
+            {
+                if constexpr(HasDma)
+                {
+                    _dmaRx->Request(1);
+                    _dmaRx->Step();
+                }
+            }
+            else if(!_held)
+            {
+                Set(I2C_SR1_RXNE);
+                if(!(control & I2C_CR1_POS))
+                    _rxneClear = ClearSteps;
+            }
+
+            if(last)
+                _state = State::Nacked;
+            else
+                _countdown = _byteSteps;
+        }
+
+        void Publish(auto regs, uint32_t interrupts)
+        {
+            regs->SR1 = _status;
+            regs->SR2 = _master;
+
+            uint32_t enabled = 0;
+            if(interrupts & I2C_CR2_ITEVTEN)
+                enabled = Events | ((interrupts & I2C_CR2_ITBUFEN) ? BufferEvents : 0);
+            uint32_t errorsEnabled = (interrupts & I2C_CR2_ITERREN) ? Errors : 0;
+
+            // Interrupt is raised by new event or by enabling interrupt of pending event
+            if((_raised & enabled) || (enabled & ~_enabled & _status))
+            {
+                ++_interrupts;
+                RegisterFile::Raise(_I2c::EventIrqHandler);
+            }
+            if((_raised & errorsEnabled) || (errorsEnabled & ~_errorsEnabled & _status))
+            {
+                ++_interrupts;
+                RegisterFile::Raise(_I2c::ErrorIrqHandler);
+            }
+            _enabled = enabled;
+            _errorsEnabled = errorsEnabled;
+        }
+
+    private:
+        uint8_t _address;
+        unsigned _byteSteps;
+        TxDmaModel* _dmaTx;
+        RxDmaModel* _dmaRx;
+
+        State _state = State::Idle;
+        uint32_t _status = 0;
+        uint32_t _master = 0;
+        uint32_t _raised = 0;
+        uint32_t _shift = 0;
+        bool _shifting = false;
+        unsigned _countdown = 0;
+        unsigned _addrClear = 0;
+        unsigned _rxneClear = 0;
+        bool _nackNext = false; ///< NACK of next byte (POS set)
+        bool _held = false; ///< Received byte waits in shift register (BTF)
+        bool _release = false; ///< Move held byte to DR on next step
+        uint8_t _pointer = 0;
+        bool _pointerSet = false;
+        uint32_t _enabled = 0;
+        uint32_t _errorsEnabled = 0;
+        uint32_t _interrupts = 0;
+        uint32_t _busSteps = 0;
+    };
+#elif defined(I2C_ISR_TCR)
+    /**
+     * @brief I2C bus model (ISR/ICR registers layout) with one slave memory device
+     *
+     * @details
+     * Device is the same as SR1/SR2 layout model has: first byte written to device sets memory
+     * pointer, next written bytes are stored to memory, read bytes are taken from memory.
+     * Every bus byte (address or data) takes byteSteps model steps. Master transfers NBYTES
+     * bytes, then sets TCR (RELOAD set), generates STOP (AUTOEND set) or sets TC and waits
+     * for START or STOP. Address NACK sets NACKF and generates STOP.
+     *
+     * Model can't see register accesses, so they are detected by values: model sets TXDR
+     * to Empty when it takes written byte, RXNE (RXDR read) is cleared 3 steps after set,
+     * NBYTES is cleared with TCR set, so new chunk is detected by non-zero NBYTES.
+     * Flags are cleared by ICR write, bus errors are not modelled. Interrupts are raised
+     * by RegisterFile::Raise, DMA requests are served by paced DMA channel models.
+     *
+     * @tparam _I2c I2C (I2c1, I2c2...)
+     */
+    template<typename _I2c>
+    class I2cDeviceModel : public PeripheralModel
+    {
+        using Regs = typename _I2c::Regs;
+        using TxDmaModel = DmaChannelModel<typename _I2c::DmaTx>;
+        using RxDmaModel = DmaChannelModel<typename _I2c::DmaRx>;
+        static constexpr bool HasDma = !std::is_same_v<typename _I2c::DmaTx, void> && !std::is_same_v<typename _I2c::DmaRx, void>;
+
+        enum class State : uint8_t
+        {
+            Idle,
+            Address,
+            Transmit,
+            Receive,
+            Reload,
+            Complete,
+            Stop,
+        };
+
+        static constexpr unsigned StartSteps = 2;
+        static constexpr unsigned StopSteps = 2;
+        static constexpr unsigned ClearSteps = 3;
+    public:
+        static constexpr uint32_t Empty = 0x100; ///< TXDR value after model takes written byte
+
+        uint8_t Memory[256] {}; ///< Device memory
+
+        /**
+         * @brief Constructor
+         *
+         * @param [in] address Device address (7-bit)
+         * @param [in] byteSteps Model steps per bus byte
+         * @param [in] dmaTx Paced TX DMA model (optional parameter)
+         * @param [in] dmaRx Paced RX DMA model (optional parameter)
+         */
+        I2cDeviceModel(uint8_t address, unsigned byteSteps = 9, TxDmaModel* dmaTx = nullptr, RxDmaModel* dmaRx = nullptr)
+            : _address(address)
+            , _byteSteps(byteSteps)
+            , _dmaTx(dmaTx)
+            , _dmaRx(dmaRx)
+        {
+            RegisterFile::Attach(*this, AddressOf(Regs::Get()), sizeof(typename Regs::DataT));
+        }
+
+        ~I2cDeviceModel() override
+        {
+            RegisterFile::Detach(*this);
+        }
+
+        /**
+         * @brief Returns count of raised interrupts since reset
+         *
+         * @returns Interrupts count
+         */
+        uint32_t Interrupts() const
+        {
+            return _interrupts;
+        }
+
+        /**
+         * @brief Returns count of steps while bus was busy since reset
+         *
+         * @returns Steps count
+         */
+        uint32_t BusSteps() const
+        {
+            return _busSteps;
+        }
+
+        void Reset() override
+        {
+            _state = State::Idle;
+            _status = 0;
+            _count = 0;
+            _shifting = false;
+            _rxneClear = 0;
+            _enabled = 0;
+            _interrupts = 0;
+            _busSteps = 0;
+        }
+
+        void Step() override
+        {
+            auto regs = Regs::Get();
+            uint32_t control = regs->CR1;
+            _raised = 0;
+
+            // ICR bits have the same positions as ISR flags
+            _status &= ~regs->ICR;
+            regs->ICR = 0;
+
+            if(!(control & I2C_CR1_PE))
+            {
+                Reset();
+                Publish(regs, control);
+                return;
+            }
+
+            if(_state != State::Idle)
+                ++_busSteps;
+
+            if(_rxneClear != 0 && --_rxneClear == 0)
+                _status &= ~I2C_ISR_RXNE;
+
+            uint32_t transfer = regs->CR2;
+            switch(_state)
+            {
+            case State::Idle:
+            case State::Complete:
+                if(transfer & I2C_CR2_START)
+                {
+                    // TC is cleared by (repeated) START
+                    _status = (_status & ~I2C_ISR_TC) | I2C_ISR_BUSY;
+                    _read = transfer & I2C_CR2_RD_WRN;
+                    _countdown = StartSteps + _byteSteps;
+                    regs->TXDR = Empty;
+                    _state = State::Address;
+                }
+                else if(_state == State::Complete && (transfer & I2C_CR2_STOP))
+                {
+                    _status &= ~I2C_ISR_TC;
+                    Stop();
+                }
+                break;
+            case State::Address:
+                if(--_countdown == 0)
+                    AddressReceived(regs, transfer);
+                break;
+            case State::Transmit:
+                Transmit(regs, control);
+                break;
+            case State::Receive:
+                Receive(regs, control);
+                break;
+            case State::Reload:
+                if(transfer & I2C_CR2_NBYTES)
+                {
+                    _count = (transfer & I2C_CR2_NBYTES) >> I2C_CR2_NBYTES_Pos;
+                    _status &= ~I2C_ISR_TCR;
+                    _countdown = _byteSteps;
+                    _state = _read ? State::Receive : State::Transmit;
+                }
+                break;
+            case State::Stop:
+                if(--_countdown == 0)
+                {
+                    Set(I2C_ISR_STOPF);
+                    _status &= ~(I2C_ISR_BUSY | I2C_ISR_TXIS);
+                    regs->CR2 &= ~I2C_CR2_STOP;
+                    _state = State::Idle;
+                }
+                break;
+            }
+
+            Publish(regs, control);
+        }
+
+    private:
+        void Set(uint32_t flags)
+        {
+            _raised |= flags & ~_status;
+            _status |= flags;
+        }
+
+        void Stop()
+        {
+            _countdown = StopSteps;
+            _state = State::Stop;
+        }
+
+        void AddressReceived(auto regs, uint32_t transfer)
+        {
+            regs->CR2 &= ~I2C_CR2_START;
+            if(((transfer & I2C_CR2_SADD) >> 1) != _address)
+            {
+                Set(I2C_ISR_NACKF);
+                Stop();
+                return;
+            }
+
+            _count = (transfer & I2C_CR2_NBYTES) >> I2C_CR2_NBYTES_Pos;
+            _shifting = false;
+            _countdown = _byteSteps;
+            if(_read)
+            {
+                _state = State::Receive;
+            }
+            else
+            {
+                _pointerSet = false;
+                _state = State::Transmit;
+            }
+        }
+
+        void ChunkTransferred(auto regs)
+        {
+            uint32_t transfer = regs->CR2;
+            if(transfer & I2C_CR2_RELOAD)
+            {
+                Set(I2C_ISR_TCR);
+                regs->CR2 = transfer & ~I2C_CR2_NBYTES;
+                _state = State::Reload;
+            }
+            else if(transfer & I2C_CR2_AUTOEND)
+            {
+                Stop();
+            }
+            else
+            {
+                Set(I2C_ISR_TC);
+                _state = State::Complete;
+            }
+        }
+
+        void Transmit(auto regs, uint32_t control)
+        {
+            if(_shifting)
+            {
+                if(--_countdown != 0)
+                    return;
+
+                _shifting = false;
+                if(_pointerSet)
+                {
+                    Memory[_pointer++] = static_cast<uint8_t>(_shift);
+                }
+                else
+                {
+                    _pointer = static_cast<uint8_t>(_shift);
+                    _pointerSet = true;
+                }
+
+                if(_count == 0)
+                {
+                    ChunkTransferred(regs);
+                    return;
+                }
+            }
+
+            // DMA writes one byte, so TXDR is cleared to tell it from Empty
+            bool requested = false;
+            if constexpr(HasDma)
+            {
+                if(regs->TXDR == Empty && (control & I2C_CR1_TXDMAEN) && _dmaTx != nullptr && _I2c::DmaTx::RemainingTransfers() > 0)
+                {
+                    regs->TXDR = 0;
+                    _dmaTx->Request(1);
+                    _dmaTx->Step();
+                    requested = true;
+                }
+            }
+
+            if(requested || regs->TXDR != Empty)
+            {
+                _shift = regs->TXDR;
+                regs->TXDR = Empty;
+                _status &= ~I2C_ISR_TXIS;
+                _shifting = true;
+                _countdown = _byteSteps;
+                --_count;
+            }
+            else
+            {
+                Set(I2C_ISR_TXIS);
+            }
+        }
+
+        void Receive(auto regs, uint32_t control)
+        {
+            // Clock is stretched until received byte is read
+            if((_status & I2C_ISR_RXNE) || --_countdown != 0)
+                return;
+
+            regs->RXDR = Memory[_pointer++];
+            --_count;
+
+            bool dma = false;
+            if constexpr(HasDma)
+            {
+                dma = (control & I2C_CR1_RXDMAEN) && _dmaRx != nullptr && _I2c::DmaRx::RemainingTransfers() > 0;
+                if(dma)
+                {
+                    _dmaRx->Request(1);
+                    _dmaRx->Step();
+                }
+            }
+            if(!dma)
+            {
+                Set(I2C_ISR_RXNE);
+                _rxneClear = ClearSteps;
+            }
+
+            if(_count == 0)
+                ChunkTransferred(regs);
+            else
+                _countdown = _byteSteps;
+        }
+
+        void Publish(auto regs, uint32_t control)
+        {
+            regs->ISR = _status;
+
+            uint32_t enabled = 0;
+            if(control & I2C_CR1_TXIE)
+                enabled |= I2C_ISR_TXIS;
+            if(control & I2C_CR1_RXIE)
+                enabled |= I2C_ISR_RXNE;
+            if(control & I2C_CR1_NACKIE)
+                enabled |= I2C_ISR_NACKF;
+            if(control & I2C_CR1_STOPIE)
+                enabled |= I2C_ISR_STOPF;
+            if(control & I2C_CR1_TCIE)
+                enabled |= I2C_ISR_TC | I2C_ISR_TCR;
+
+            // Interrupt is raised by new event or by enabling interrupt of pending event
+            if((_raised & enabled) || (enabled & ~_enabled & _status))
+            {
+                ++_interrupts;
+                RegisterFile::Raise(_I2c::EventIrqHandler);
+            }
+            _enabled = enabled;
+        }
+
+    private:
+        uint8_t _address;
+        unsigned _byteSteps;
+        TxDmaModel* _dmaTx;
+        RxDmaModel* _dmaRx;
+
+        State _state = State::Idle;
+        uint32_t _status = 0;
+        uint32_t _raised = 0;
+        uint32_t _shift = 0;
+        bool _read = false;
+        bool _shifting = false;
+        unsigned _count = 0; ///< Bytes of current chunk (NBYTES) not taken yet
+        unsigned _countdown = 0;
+        unsigned _rxneClear = 0;
+        uint8_t _pointer = 0;
+        bool _pointerSet = false;
+        uint32_t _enabled = 0;
+        uint32_t _interrupts = 0;
+        uint32_t _busSteps = 0;
+    };
+#endif
+} // namespace Zhele::Host
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_HOST_MODELS_H
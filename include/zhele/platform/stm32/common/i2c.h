@@ -10,14 +10,17 @@
 #ifndef ZHELE_PLATFORM_STM32_COMMON_I2C_H
 #define ZHELE_PLATFORM_STM32_COMMON_I2C_H
 
+#include <zhele/common/delegate.h>
 #include <zhele/common/template_utils/enum.h>
 #include <zhele/common/template_utils/type_list.h>
 
 #include <zhele/clock.h>
+#include <zhele/containers/spsc_ring_buffer.h>
 #include <zhele/iopins.h>
 #include <zhele/pinlist.h>
 
 #include <functional>
+#include <type_traits>
 
 #if defined(I2C_ISR_BUSY)
     #define I2C_TYPE_1
@@ -138,7 +141,20 @@ namespace Zhele
         I2cStatus Status;        
     };
 
-    using I2cCallback = std::add_pointer_t<void(I2cStatus status)>;
+    using I2cCallback = Delegate<void(I2cStatus status)>;
+
+    /**
+     * @brief I2C transaction (write, read or write then read with repeated start)
+     */
+    struct I2cTransaction
+    {
+        uint8_t DevAddr; ///< Device address (7-bit)
+        const uint8_t* WriteBuffer; ///< Data to write (register address and data)
+        uint16_t WriteSize; ///< Write size (zero to read only)
+        uint8_t* ReadBuffer; ///< Buffer for data read after write
+        uint16_t ReadSize; ///< Read size (zero to write only)
+        I2cCallback OnComplete; ///< Transaction complete (or error) callback (called from interrupt)
+    };
 
     namespace Private
     {
@@ -177,7 +193,10 @@ namespace Zhele
             };
 
             static AsyncTransferData _transferData;
+
+            static constexpr bool HasDma = !std::is_same_v<_DmaTx, void> && !std::is_same_v<_DmaRx, void>;
         public:
+            using Regs = _Regs;
             using SclPins = _SclPins;
             using SdaPins = _SdaPins;
 
@@ -199,7 +218,35 @@ namespace Zhele
         #if defined (I2C_TYPE_2)
             static void Init(uint32_t i2cClockSpeed = 100000U, bool dutyCycle2 = false);
         #endif
-            
+
+        #if defined (I2C_TYPE_1)
+            /**
+             * @brief Initialize I2C with TIMINGR value solved at compile time
+             *
+             * @details Compilation fails if given SCL frequency is not achievable
+             * with given kernel clock. SCL frequency above 400 kHz selects
+             * Fast-mode Plus and enables FM+ drive of I2C pins.
+             *
+             * @tparam _ClockFreq I2C kernel clock frequency (Hz)
+             * @tparam _SclFreq SCL frequency (Hz), up to 1 MHz
+             * @tparam _RiseTime SCL/SDA rise time (ns)
+             * @tparam _FallTime SCL/SDA fall time (ns)
+             *
+             * @par Returns
+             * 	Nothing
+             */
+            template<uint32_t _ClockFreq, uint32_t _SclFreq, uint32_t _RiseTime = 25, uint32_t _FallTime = 10>
+            static void Init();
+
+            /**
+             * @brief Enable Fast-mode Plus (20 mA) drive of I2C pins
+             *
+             * @par Returns
+             * 	Nothing
+             */
+            static void EnableFastModePlus();
+        #endif
+
             /**
              * @brief Write 8-bit unsigned to register
              * 
@@ -314,8 +361,45 @@ namespace Zhele
              */
             static bool WaitWhileBusy();
             
+            /// Transactions queue size (see Enqueue)
+            static const unsigned TransactionQueueSize = 8;
+
             /**
-             * @brief Event IRQ handler
+             * @brief Enqueue transaction
+             * 
+             * @details
+             * Transactions are executed one by one by interrupts (EventIrqHandler, ErrorIrqHandler)
+             * and DMA (if I2C has DMA), so CPU doesn't poll status register. Transaction starts
+             * immediately if queue is idle. Buffers must be valid until transaction completes.
+             * Event and error interrupt handlers must call EventIrqHandler and ErrorIrqHandler
+             * (one handler is enough if I2C has common interrupt). I2C with SR1/SR2 registers
+             * also needs RX DMA interrupt handler (DmaRx::IrqHandler).
+             * Do not call blocking and async methods while queue is not idle.
+             * 
+             * @param [in] transaction Transaction
+             * 
+             * @retval true Transaction queued
+             * @retval false Queue is full
+             */
+            static bool Enqueue(const I2cTransaction& transaction);
+
+            /**
+             * @brief Returns count of not completed transactions (including current)
+             * 
+             * @returns Transactions count
+             */
+            static size_t Pending();
+
+            /**
+             * @brief Check that transactions queue is idle
+             * 
+             * @retval true All transactions are completed
+             * @retval false Transaction in progress
+             */
+            static bool Idle();
+
+            /**
+             * @brief Event IRQ handler (drives queued transactions)
              * 
              * @par Returns
              *  Nothing
@@ -323,7 +407,7 @@ namespace Zhele
             static void EventIrqHandler();
             
             /**
-             * @brief Error IRQ handler
+             * @brief Error IRQ handler (completes current transaction with error)
              * 
              * @par Returns
              *  Nothing
@@ -435,6 +519,27 @@ namespace Zhele
              * @returns Event bitmask
              */
             static uint32_t GetLastEvent();
+
+            static void StartNext();
+            static void Finish(I2cStatus status);
+        #if defined (I2C_TYPE_1)
+            static void ApplyTiming(uint32_t timing);
+            static void StartPhase(bool read);
+        #endif
+        #if defined (I2C_TYPE_2)
+            static void AddressSent();
+            static void WriteCompleted();
+            static void ReadCompleted(void* data, unsigned size, bool success);
+        #endif
+
+            static inline Containers::SpscRingBuffer<TransactionQueueSize, I2cTransaction> _queue;
+            static inline volatile bool _busy = false;
+            static inline bool _reading = false; ///< Current phase is read
+            static inline uint16_t _index = 0; ///< Count of bytes moved by CPU (or handed to DMA) in current phase
+        #if defined (I2C_TYPE_1)
+            static inline uint16_t _unprogrammed = 0; ///< Bytes of current phase not yet programmed to NBYTES
+            static inline I2cStatus _status = I2cStatus::Success;
+        #endif
         };
     }
 }
@@ -190,7 +190,7 @@ namespace Zhele::Clock
 
         Flash::ConfigureFrequence(resultFrequence);
 
-        RCC->CFGR = clockSelectMask;
+        RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW) | clockSelectMask;
         
         uint32_t timeout = 10000;
         while (((RCC->CFGR & RCC_CFGR_SWS) != clockStatusValue) && --timeout)
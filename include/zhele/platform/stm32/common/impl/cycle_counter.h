@@ -0,0 +1,87 @@
+/**
+ * @file
+ * Cycle counter methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_CYCLE_COUNTER_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_CYCLE_COUNTER_H
+
+namespace Zhele
+{
+    inline void CycleCounter::Enable()
+    {
+    #if defined(DWT_CTRL_CYCCNTENA_Msk)
+        if(Private::DwtRegs()->CTRL & DWT_CTRL_CYCCNTENA_Msk)
+            return;
+        Private::CoreDebugRegs()->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        Private::DwtRegs()->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    #else
+        // Running SysTick is system tick timer: its settings (and TICKINT) are kept
+        if(Private::SysTickRegs()->CTRL & SysTick_CTRL_ENABLE_Msk)
+            return;
+        Private::SysTickRegs()->LOAD = Mask;
+        Private::SysTickRegs()->VAL = 0;
+        Private::SysTickRegs()->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+    #endif
+    }
+
+    inline CycleCounter::Ticks CycleCounter::Now()
+    {
+    #if defined(DWT_CTRL_CYCCNTENA_Msk)
+        return Private::DwtRegs()->CYCCNT;
+    #else
+        // SysTick counts down from LOAD
+        return (Private::SysTickRegs()->LOAD - Private::SysTickRegs()->VAL) * TickCycles();
+    #endif
+    }
+
+    inline CycleCounter::Ticks CycleCounter::Elapsed(Ticks since)
+    {
+        return Elapsed(since, Now());
+    }
+
+    inline CycleCounter::Ticks CycleCounter::Elapsed(Ticks since, Ticks now)
+    {
+    #if defined(DWT_CTRL_CYCCNTENA_Msk)
+        return now - since;
+    #else
+        return now >= since ? now - since : now + Period() - since;
+    #endif
+    }
+
+    inline void CycleCounter::WaitPeriod(Ticks& edge, Ticks period)
+    {
+        Ticks elapsed;
+        while((elapsed = Elapsed(edge)) < period);
+
+        edge += elapsed < period * 2 ? period : elapsed;
+    #if !defined(DWT_CTRL_CYCCNTENA_Msk)
+        if(edge >= Period())
+            edge -= Period();
+    #endif
+    }
+
+    inline void CycleCounter::Delay(Ticks cycles)
+    {
+        Ticks start = Now();
+        while(Elapsed(start) < cycles);
+    }
+
+#if !defined(DWT_CTRL_CYCCNTENA_Msk)
+    inline CycleCounter::Ticks CycleCounter::Period()
+    {
+        return (Private::SysTickRegs()->LOAD + 1) * TickCycles();
+    }
+
+    inline CycleCounter::Ticks CycleCounter::TickCycles()
+    {
+        return (Private::SysTickRegs()->CTRL & SysTick_CTRL_CLKSOURCE_Msk) ? 1 : 8;
+    }
+#endif
+}
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_CYCLE_COUNTER_H
@@ -110,6 +110,37 @@ namespace Zhele::Private
     {
         _Regs()->SWTRIGR = 1 << _Channel;
     }
+
+    DAC_TEMPLATE_ARGS
+    void DAC_TEMPLATE_QUALIFIER::EnableDma()
+    {
+        _Regs()->CR |= DAC_CR_DMAEN1 << (_Channel * ChannelOffset);
+    }
+
+    DAC_TEMPLATE_ARGS
+    void DAC_TEMPLATE_QUALIFIER::DisableDma()
+    {
+        _Regs()->CR &= ~(DAC_CR_DMAEN1 << (_Channel * ChannelOffset));
+    }
+
+    DAC_TEMPLATE_ARGS
+    template <typename _DmaChannel>
+    void DAC_TEMPLATE_QUALIFIER::WriteAsyncList(const DmaDescriptor* descriptors, uint16_t count, bool circular, DmaChannelData::TransferCallback callback)
+    {
+        auto mode = _DmaChannel::Mem2Periph | _DmaChannel::MemIncrement | _DmaChannel::MSize16Bits | _DmaChannel::PSize16Bits;
+        if (circular)
+            mode = mode | _DmaChannel::Circular;
+
+        volatile void* dataRegister;
+        if constexpr (_Channel == 0)
+            dataRegister = &_Regs()->DHR12R1;
+        else
+            dataRegister = &_Regs()->DHR12R2;
+
+        EnableDma();
+        _DmaChannel::SetTransferCallback(callback);
+        _DmaChannel::TransferList(mode, descriptors, count, dataRegister);
+    }
 }
 
 #endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_DAC_H
\ No newline at end of file
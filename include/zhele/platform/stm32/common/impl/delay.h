@@ -0,0 +1,32 @@
+/**
+ * @file
+ * Delay methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_DELAY_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_DELAY_H
+
+namespace Zhele::Private
+{
+    inline void DelayCycles(uint32_t cycles)
+    {
+        CycleCounter::Enable();
+
+        // Elapsed cycles are accumulated, so delay may exceed counter period. Counter
+        // is read in cycles (SysTick with HCLK/8 clock too), so delay is never shorter.
+        CycleCounter::Ticks last = CycleCounter::Now();
+        uint32_t elapsed = 0;
+        while(elapsed < cycles)
+        {
+            CycleCounter::Ticks now = CycleCounter::Now();
+            elapsed += CycleCounter::Elapsed(last, now);
+            last = now;
+        }
+    }
+}
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_DELAY_H
@@ -41,6 +41,118 @@ namespace Zhele
             while(!Ready())
                 ;
         }
+
+        _descriptorCount = 0;
+        Data.data = const_cast<void*>(buffer);
+        Data.size = bufferSize;
+
+        if(Data.transferCallback)
+            mode = mode | DmaBase::TransferCompleteInterrupt | DmaBase::TransferErrorInterrupt;
+
+        Start(mode, buffer, periph, bufferSize ONLY_IF_STREAM_SUPPORTED(COMMA channel));
+    }
+
+    DMACHANNEL_TEMPLATE_ARGS
+    template<typename _Buffer>
+    void DMACHANNEL_TEMPLATE_QUALIFIER::TransferList(Mode mode, const BasicDmaDescriptor<_Buffer>* descriptors, uint16_t count, volatile void* periph
+    ONLY_IF_STREAM_SUPPORTED(COMMA uint8_t channel))
+    {
+        if(count == 0)
+            return;
+
+        _Module::Enable();
+        if(!TransferError())
+        {
+            while(!Ready())
+                ;
+        }
+
+        uint16_t first = 0;
+        while(first < count && descriptors[first].size == 0)
+            ++first;
+
+        Data.data = const_cast<BasicDmaDescriptor<_Buffer>*>(descriptors);
+        Data.size = count;
+        if(first == count)
+        {
+            _descriptorCount = 0;
+            Data.NotifyTransferComplete();
+            return;
+        }
+
+        _descriptors = descriptors;
+        _loadDescriptor = LoadDescriptor<_Buffer>;
+        _descriptorCount = count;
+        _descriptorIndex = first;
+        _descriptorLoop = (mode & Mode::Circular) != 0;
+
+        // List is restarted by software, hardware circular mode would repeat first descriptor only
+        mode = (mode & ~Mode::Circular) | DmaBase::TransferCompleteInterrupt | DmaBase::TransferErrorInterrupt;
+
+        Start(mode, descriptors[first].buffer, periph, descriptors[first].size ONLY_IF_STREAM_SUPPORTED(COMMA channel));
+    }
+
+    DMACHANNEL_TEMPLATE_ARGS
+    uint16_t DMACHANNEL_TEMPLATE_QUALIFIER::CurrentDescriptor()
+    {
+        return _descriptorIndex;
+    }
+
+#if defined(DMA_SxCR_DBM)
+    DMACHANNEL_TEMPLATE_ARGS
+    void DMACHANNEL_TEMPLATE_QUALIFIER::TransferDoubleBuffer(Mode mode, void* buffer0, void* buffer1, volatile void* periph, uint16_t bufferSize, uint8_t channel)
+    {
+        _Module::Enable();
+        if(!TransferError())
+        {
+            while(!Ready())
+                ;
+        }
+
+        _descriptorCount = 0;
+        Data.data = buffer0;
+        Data.size = bufferSize;
+
+        // Circular bit is don't care in double-buffer mode, but IrqHandler checks it
+        mode = mode | Mode::Circular | DMA_SxCR_DBM;
+        if(Data.transferCallback)
+            mode = mode | DmaBase::TransferCompleteInterrupt | DmaBase::TransferErrorInterrupt;
+
+        _ChannelRegs()->CR = 0;
+        _ChannelRegs()->M1AR = reinterpret_cast<uint32_t>(buffer1);
+        Start(mode, buffer0, periph, bufferSize, channel);
+    }
+
+    DMACHANNEL_TEMPLATE_ARGS
+    uint8_t DMACHANNEL_TEMPLATE_QUALIFIER::IdleBufferIndex()
+    {
+        return (_ChannelRegs()->CR & DMA_SxCR_CT) ? 0 : 1;
+    }
+
+    DMACHANNEL_TEMPLATE_ARGS
+    void* DMACHANNEL_TEMPLATE_QUALIFIER::IdleBuffer()
+    {
+        return reinterpret_cast<void*>((_ChannelRegs()->CR & DMA_SxCR_CT) ? _ChannelRegs()->M0AR : _ChannelRegs()->M1AR);
+    }
+
+    DMACHANNEL_TEMPLATE_ARGS
+    bool DMACHANNEL_TEMPLATE_QUALIFIER::SetIdleBuffer(void* buffer)
+    {
+        // Write to address register of current buffer disables stream with transfer error, check that target is not changed during write
+        uint32_t target = _ChannelRegs()->CR & DMA_SxCR_CT;
+        if(target)
+            _ChannelRegs()->M0AR = reinterpret_cast<uint32_t>(buffer);
+        else
+            _ChannelRegs()->M1AR = reinterpret_cast<uint32_t>(buffer);
+
+        return (_ChannelRegs()->CR & DMA_SxCR_CT) == target;
+    }
+#endif
+
+    DMACHANNEL_TEMPLATE_ARGS
+    void DMACHANNEL_TEMPLATE_QUALIFIER::Start(Mode mode, const void* buffer, volatile void* periph, uint32_t bufferSize
+    ONLY_IF_STREAM_SUPPORTED(COMMA uint8_t channel))
+    {
     #if defined (DMA_CCR_EN)
         _ChannelRegs()->CCR = 0;
         _ChannelRegs()->CNDTR = bufferSize;
@@ -53,12 +165,6 @@ namespace Zhele
         _ChannelRegs()->PAR = reinterpret_cast<uint32_t>(periph);
         _ChannelRegs()->M0AR = reinterpret_cast<uint32_t>(buffer);
     #endif
-    Data.data = const_cast<void*>(buffer);
-    Data.size = bufferSize;
-
-    if(Data.transferCallback)
-        mode = mode | DmaBase::TransferCompleteInterrupt | DmaBase::TransferErrorInterrupt;
-
     NVIC_EnableIRQ(_IRQNumber);
 
     #if defined (DMA_CCR_EN)
@@ -69,6 +175,37 @@ namespace Zhele
         _ChannelRegs()->CR = mode | ((channel & 0x07) << 25) | DMA_SxCR_EN;
     #endif
     }
+
+    DMACHANNEL_TEMPLATE_ARGS
+    template<typename _Buffer>
+    uint16_t DMACHANNEL_TEMPLATE_QUALIFIER::LoadDescriptor(uint16_t index)
+    {
+        const auto* descriptors = static_cast<const BasicDmaDescriptor<_Buffer>*>(_descriptors);
+        while(index < _descriptorCount && descriptors[index].size == 0)
+            ++index;
+        if(index == _descriptorCount)
+            return index;
+
+        const auto& descriptor = descriptors[index];
+    #if defined (DMA_CCR_EN)
+        uint32_t control = _ChannelRegs()->CCR;
+        _ChannelRegs()->CCR = control & ~DMA_CCR_EN;
+        _ChannelRegs()->CMAR = reinterpret_cast<uint32_t>(descriptor.buffer);
+        _ChannelRegs()->CNDTR = descriptor.size;
+        _ChannelRegs()->CCR = control | DMA_CCR_EN;
+    #endif
+    #if defined (DMA_SxCR_EN)
+        uint32_t control = _ChannelRegs()->CR;
+        _ChannelRegs()->CR = control & ~DMA_SxCR_EN;
+        while(_ChannelRegs()->CR & DMA_SxCR_EN)
+            ;
+        _ChannelRegs()->M0AR = reinterpret_cast<uint32_t>(descriptor.buffer);
+        _ChannelRegs()->NDTR = descriptor.size;
+        _ChannelRegs()->CR = control | DMA_SxCR_EN;
+    #endif
+        return index;
+    }
+
     DMACHANNEL_TEMPLATE_ARGS
     void DMACHANNEL_TEMPLATE_QUALIFIER::SetTransferCallback(DmaChannelData::TransferCallback callback)
     {
@@ -84,19 +221,19 @@ namespace Zhele
     DMACHANNEL_TEMPLATE_ARGS
     bool DMACHANNEL_TEMPLATE_QUALIFIER::Enabled()
     {
-        return _ChannelRegs()->ONLY_FOR_CCR(CCR)ONLY_FOR_SXCR(CR) & ONLY_FOR_CCR(DMA_CCR_EN)ONLY_FOR_SXCR(DMA_SxCR_EN);
+        return BitBand::IsSet(_ChannelRegs()->ONLY_FOR_CCR(CCR)ONLY_FOR_SXCR(CR), ONLY_FOR_CCR(DMA_CCR_EN_Pos)ONLY_FOR_SXCR(DMA_SxCR_EN_Pos));
     }
 
     DMACHANNEL_TEMPLATE_ARGS
     void DMACHANNEL_TEMPLATE_QUALIFIER::Enable()
     {
-        _ChannelRegs()->ONLY_FOR_CCR(CCR)ONLY_FOR_SXCR(CR) |= ONLY_FOR_CCR(DMA_CCR_EN)ONLY_FOR_SXCR(DMA_SxCR_EN);
+        BitBand::Set(_ChannelRegs()->ONLY_FOR_CCR(CCR)ONLY_FOR_SXCR(CR), ONLY_FOR_CCR(DMA_CCR_EN_Pos)ONLY_FOR_SXCR(DMA_SxCR_EN_Pos));
     }
 
     DMACHANNEL_TEMPLATE_ARGS
     void DMACHANNEL_TEMPLATE_QUALIFIER::Disable()
     {
-        _ChannelRegs()->ONLY_FOR_CCR(CCR)ONLY_FOR_SXCR(CR) &= ~ONLY_FOR_CCR(DMA_CCR_EN)ONLY_FOR_SXCR(DMA_SxCR_EN);
+        BitBand::Clear(_ChannelRegs()->ONLY_FOR_CCR(CCR)ONLY_FOR_SXCR(CR), ONLY_FOR_CCR(DMA_CCR_EN_Pos)ONLY_FOR_SXCR(DMA_SxCR_EN_Pos));
     }
 
     DMACHANNEL_TEMPLATE_ARGS
@@ -177,15 +314,36 @@ namespace Zhele
         if(TransferComplete())
         {
             ClearFlags();
-            
-            if(static_cast<uint32_t>(_ChannelRegs()->ONLY_FOR_CCR(CCR)ONLY_FOR_SXCR(CR) & Mode::Circular) == 0)
-                Disable();
 
-            Data.NotifyTransferComplete();
+            uint16_t next = _descriptorCount != 0 ? _loadDescriptor(_descriptorIndex + 1) : 0;
+            if(next < _descriptorCount)
+            {
+                _descriptorIndex = next;
+            }
+            else if(_descriptorCount != 0 && _descriptorLoop)
+            {
+                // List has non-empty descriptor (checked on start)
+                _descriptorIndex = _loadDescriptor(0);
+                Data.NotifyTransferComplete();
+            }
+            else
+            {
+                _descriptorCount = 0;
+
+                if(static_cast<uint32_t>(_ChannelRegs()->ONLY_FOR_CCR(CCR)ONLY_FOR_SXCR(CR) & Mode::Circular) == 0)
+                    Disable();
+            #if defined(DMA_SxCR_DBM)
+                if(_ChannelRegs()->CR & DMA_SxCR_DBM)
+                    Data.data = IdleBuffer();
+            #endif
+
+                Data.NotifyTransferComplete();
+            }
         }
         if(TransferError())
         {
             ClearFlags();
+            _descriptorCount = 0;
 
             if(static_cast<uint32_t>(_ChannelRegs()->ONLY_FOR_CCR(CCR)ONLY_FOR_SXCR(CR) & Mode::Circular) == 0)
                 Disable();
@@ -0,0 +1,80 @@
+/**
+ * @file
+ * DMA channel allocator methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_DMA_ALLOCATOR_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_DMA_ALLOCATOR_H
+
+namespace Zhele
+{
+    #define DMA_ALLOCATOR_TEMPLATE_ARGS template<typename... _Pool, typename... _Users>
+    #define DMA_ALLOCATOR_TEMPLATE_QUALIFIER DmaAllocator<template_utils::type_list<_Pool...>, template_utils::type_list<_Users...>>
+
+    DMA_ALLOCATOR_TEMPLATE_ARGS
+    consteval std::array<int, sizeof...(_Users)> DMA_ALLOCATOR_TEMPLATE_QUALIFIER::Assign()
+    {
+        // Trailing elements keep arrays non-empty for empty pool or users list
+        constexpr bool claimed[] = {(Claims<_Pool>() > 0)..., false};
+        constexpr bool automatic[] = {std::is_void_v<typename _Users::Channel>..., false};
+
+        bool used[sizeof...(_Pool) + 1] = {};
+        std::array<int, sizeof...(_Users)> result = {};
+
+        for(unsigned pool = 0; pool < sizeof...(_Pool); ++pool)
+            used[pool] = claimed[pool];
+
+        for(unsigned user = 0; user < sizeof...(_Users); ++user)
+        {
+            if(!automatic[user])
+            {
+                result[user] = Fixed;
+                continue;
+            }
+
+            result[user] = Exhausted;
+            for(unsigned pool = 0; pool < sizeof...(_Pool); ++pool)
+            {
+                if(!used[pool])
+                {
+                    used[pool] = true;
+                    result[user] = static_cast<int>(pool);
+                    break;
+                }
+            }
+        }
+
+        return result;
+    }
+
+#if defined(DMAMUX1)
+    DMA_ALLOCATOR_TEMPLATE_ARGS
+    template<typename _User>
+    void DMA_ALLOCATOR_TEMPLATE_QUALIFIER::Route()
+    {
+        using DmaChannel = Channel<_User>;
+        // DMAMUX channels follow DMA1 channels, then DMA2 channels
+        constexpr unsigned muxChannel = (std::is_same_v<typename DmaChannel::Module, Dma1> ? 0 : Dma1::Channels) + DmaChannel::Channel - 1;
+
+        DmaMux1::template Channel<muxChannel>::SelectRequestInput(static_cast<typename DmaMux1::RequestInput>(_User::Request));
+    }
+#endif
+
+    DMA_ALLOCATOR_TEMPLATE_ARGS
+    void DMA_ALLOCATOR_TEMPLATE_QUALIFIER::Init()
+    {
+        (Channel<_Users>::Module::Enable(), ...);
+    #if defined(DMAMUX1)
+        (Route<_Users>(), ...);
+    #endif
+    }
+
+    #undef DMA_ALLOCATOR_TEMPLATE_ARGS
+    #undef DMA_ALLOCATOR_TEMPLATE_QUALIFIER
+}
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_DMA_ALLOCATOR_H
@@ -0,0 +1,149 @@
+/**
+ * @file
+ * DMA memory copy/fill service methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_DMA_MEMORY_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_DMA_MEMORY_H
+
+#include <cstring>
+
+namespace Zhele
+{
+    #define DMA_MEMORY_TEMPLATE_ARGS template<typename _DmaChannel, size_t _CpuThreshold>
+    #define DMA_MEMORY_TEMPLATE_QUALIFIER DmaMemory<_DmaChannel, _CpuThreshold>
+
+    DMA_MEMORY_TEMPLATE_ARGS
+    bool DMA_MEMORY_TEMPLATE_QUALIFIER::Copy(void* destination, const void* source, size_t size, Callback callback)
+    {
+        if(size < _threshold)
+        {
+            std::memcpy(destination, source, size);
+            if(callback)
+                callback(true);
+            return true;
+        }
+
+        return Start(static_cast<uint8_t*>(destination), static_cast<const uint8_t*>(source), size, callback);
+    }
+
+    DMA_MEMORY_TEMPLATE_ARGS
+    bool DMA_MEMORY_TEMPLATE_QUALIFIER::Fill(void* destination, uint8_t value, size_t size, Callback callback)
+    {
+        if(size < _threshold)
+        {
+            std::memset(destination, value, size);
+            if(callback)
+                callback(true);
+            return true;
+        }
+
+        if(_busy)
+            return false;
+
+        _pattern = value * 0x01010101u;
+        return Start(static_cast<uint8_t*>(destination), nullptr, size, callback);
+    }
+
+    DMA_MEMORY_TEMPLATE_ARGS
+    bool DMA_MEMORY_TEMPLATE_QUALIFIER::Busy()
+    {
+        return _busy;
+    }
+
+    DMA_MEMORY_TEMPLATE_ARGS
+    void DMA_MEMORY_TEMPLATE_QUALIFIER::SetThreshold(size_t threshold)
+    {
+        _threshold = threshold;
+    }
+
+    DMA_MEMORY_TEMPLATE_ARGS
+    size_t DMA_MEMORY_TEMPLATE_QUALIFIER::Threshold()
+    {
+        return _threshold;
+    }
+
+    DMA_MEMORY_TEMPLATE_ARGS
+    bool DMA_MEMORY_TEMPLATE_QUALIFIER::Start(uint8_t* destination, const uint8_t* source, size_t size, Callback callback)
+    {
+        if(_busy)
+            return false;
+
+        _busy = true;
+        _destination = destination;
+        _source = source;
+        _remaining = size;
+        _callback = callback;
+
+        _DmaChannel::SetTransferCallback(TransferCompleted);
+        StartChunk();
+        return true;
+    }
+
+    DMA_MEMORY_TEMPLATE_ARGS
+    void DMA_MEMORY_TEMPLATE_QUALIFIER::StartChunk()
+    {
+        uintptr_t alignment = reinterpret_cast<uintptr_t>(_destination) | reinterpret_cast<uintptr_t>(_source) | _remaining;
+        auto mode = _DmaChannel::Mem2Mem | _DmaChannel::MemIncrement;
+        unsigned itemSize = 1;
+        if((alignment & 0x03) == 0)
+        {
+            mode = mode | _DmaChannel::MSize32Bits | _DmaChannel::PSize32Bits;
+            itemSize = 4;
+        }
+        else if((alignment & 0x01) == 0)
+        {
+            mode = mode | _DmaChannel::MSize16Bits | _DmaChannel::PSize16Bits;
+            itemSize = 2;
+        }
+
+        size_t items = _remaining / itemSize;
+        if(items > 0xffff)
+            items = 0xffff;
+        _chunk = items * itemSize;
+
+        // In memory-to-memory mode source is peripheral side of channel
+        volatile void* source = &_pattern;
+        if(_source != nullptr)
+        {
+            mode = mode | _DmaChannel::PeriphIncrement;
+            source = const_cast<uint8_t*>(_source);
+        }
+
+        _DmaChannel::Transfer(mode, _destination, source, items);
+    }
+
+    DMA_MEMORY_TEMPLATE_ARGS
+    void DMA_MEMORY_TEMPLATE_QUALIFIER::Finish(bool success)
+    {
+        _busy = false;
+        if(_callback)
+            _callback(success);
+    }
+
+    DMA_MEMORY_TEMPLATE_ARGS
+    void DMA_MEMORY_TEMPLATE_QUALIFIER::TransferCompleted([[maybe_unused]] void* data, [[maybe_unused]] unsigned size, bool success)
+    {
+        if(!success)
+        {
+            Finish(false);
+            return;
+        }
+
+        _destination += _chunk;
+        if(_source != nullptr)
+            _source += _chunk;
+        _remaining -= _chunk;
+
+        if(_remaining > 0)
+            StartChunk();
+        else
+            Finish(true);
+    }
+}
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_DMA_MEMORY_H
@@ -67,15 +67,148 @@ namespace Zhele
         return (scll << I2C_TIMINGR_SCLL_Pos) | (sclh << I2C_TIMINGR_SCLH_Pos) | (scldel << I2C_TIMINGR_SCLDEL_Pos) | (presc << I2C_TIMINGR_PRESC_Pos);
     }
 
+    /**
+     * @brief TIMINGR fields
+     */
+    struct I2cTiming
+    {
+        uint8_t Prescaler;
+        uint8_t DataSetup; ///< SCLDEL
+        uint8_t DataHold; ///< SDADEL
+        uint8_t High; ///< SCLH
+        uint8_t Low; ///< SCLL
+        bool Valid;
+
+        constexpr uint32_t Value() const
+        {
+            return (static_cast<uint32_t>(Prescaler) << I2C_TIMINGR_PRESC_Pos)
+                | (static_cast<uint32_t>(DataSetup) << I2C_TIMINGR_SCLDEL_Pos)
+                | (static_cast<uint32_t>(DataHold) << I2C_TIMINGR_SDADEL_Pos)
+                | (static_cast<uint32_t>(High) << I2C_TIMINGR_SCLH_Pos)
+                | (static_cast<uint32_t>(Low) << I2C_TIMINGR_SCLL_Pos);
+        }
+    };
+
+    /**
+     * @brief Solve TIMINGR fields (analog filter on, digital filter off)
+     * 
+     * @details Search follows reference manual "I2C timings" section:
+     * minimal SCLDEL/SDADEL that meet data setup/hold limits of I2C-bus specification,
+     * then SCLL/SCLH that meet SCL low/high limits with period closest to (but not shorter than)
+     * nominal one and not longer than nominal one by 25%.
+     * 
+     * @param [in] sourceClock I2C kernel clock (Hz)
+     * @param [in] sclClock SCL frequency (Hz)
+     * @param [in] riseTime Rise time (ns)
+     * @param [in] fallTime Fall time (ns)
+     * 
+     * @returns Timing (Valid is false if there is no solution)
+     */
+    consteval I2cTiming SolveTiming(uint32_t sourceClock, uint32_t sclClock, uint32_t riseTime, uint32_t fallTime)
+    {
+        I2cTiming result{};
+        if (sourceClock == 0 || sclClock == 0 || sclClock > 1000000)
+            return result;
+
+        // All times are in picoseconds
+        const bool stdMode = sclClock <= 100000;
+        const bool fstMode = sclClock <= 400000;
+        const int64_t lowMin = (stdMode ? 4700 : fstMode ? 1300 : 500) * 1000ll;
+        const int64_t highMin = (stdMode ? 4000 : fstMode ? 600 : 260) * 1000ll;
+        const int64_t suDatMin = (stdMode ? 250 : fstMode ? 100 : 50) * 1000ll;
+        const int64_t vdDatMax = (stdMode ? 3450 : fstMode ? 900 : 450) * 1000ll;
+        const int64_t filterMin = 50000;
+        const int64_t filterMax = 260000;
+
+        const int64_t tClk = 1000000000000ll / sourceClock;
+        const int64_t tRise = riseTime * 1000ll;
+        const int64_t tFall = fallTime * 1000ll;
+        const int64_t tSync = filterMin + 2 * tClk;
+        const int64_t periodMin = 1000000000000ll / sclClock;
+        const int64_t periodMax = periodMin * 5 / 4;
+
+        const int64_t scldelMin = tRise + suDatMin;
+        const int64_t sdadelMin = tFall - filterMin - 3 * tClk > 0 ? tFall - filterMin - 3 * tClk : 0;
+        const int64_t sdadelMax = vdDatMax - tRise - filterMax - 4 * tClk > 0 ? vdDatMax - tRise - filterMax - 4 * tClk : 0;
+
+        int64_t bestError = periodMax;
+        for (int64_t presc = 0; presc < 16; ++presc)
+        {
+            const int64_t tPresc = (presc + 1) * tClk;
+
+            const int64_t scldel = scldelMin > tPresc ? (scldelMin + tPresc - 1) / tPresc - 1 : 0;
+            const int64_t sdadel = (sdadelMin + tPresc - 1) / tPresc;
+            if (scldel > 15 || sdadel > 15 || sdadel * tPresc > sdadelMax)
+                continue;
+
+            for (int64_t scll = 0; scll < 256; ++scll)
+            {
+                const int64_t tLow = (scll + 1) * tPresc + tSync;
+                if (tLow + tRise + tFall > periodMax)
+                    break;
+                if (tLow < lowMin || tLow - filterMin <= 4 * tClk)
+                    continue;
+
+                // Shortest high period that meets both high time and period limits
+                const int64_t tHighMin = highMin > periodMin - tLow - tRise - tFall ? highMin : periodMin - tLow - tRise - tFall;
+                const int64_t sclh = tHighMin > tSync + tPresc ? (tHighMin - tSync + tPresc - 1) / tPresc - 1 : 0;
+                if (sclh > 255)
+                    continue;
+
+                const int64_t period = tLow + (sclh + 1) * tPresc + tSync + tRise + tFall;
+                if (period > periodMax || period - periodMin >= bestError)
+                    continue;
+
+                bestError = period - periodMin;
+                result = I2cTiming {
+                    static_cast<uint8_t>(presc),
+                    static_cast<uint8_t>(scldel),
+                    static_cast<uint8_t>(sdadel),
+                    static_cast<uint8_t>(sclh),
+                    static_cast<uint8_t>(scll),
+                    true};
+            }
+        }
+
+        return result;
+    }
+
     I2C_TEMPLATE_ARGS
     void I2C_TEMPLATE_QUALIFIER::Init(uint32_t i2cClockSpeed)
     {
         _ClockCtrl::Enable();
-        
+
+        if (i2cClockSpeed > 400000)
+            EnableFastModePlus();
+
+        ApplyTiming(CalcTiming(_ClockCtrl::ClockFreq(), i2cClockSpeed));
+    }
+
+    I2C_TEMPLATE_ARGS
+    template<uint32_t _ClockFreq, uint32_t _SclFreq, uint32_t _RiseTime, uint32_t _FallTime>
+    void I2C_TEMPLATE_QUALIFIER::Init()
+    {
+        static_assert(_ClockFreq > 0, "I2C kernel clock frequency must be non-zero");
+        static_assert(_SclFreq > 0 && _SclFreq <= 1000000, "I2C SCL frequency must be up to 1 MHz (Fast-mode Plus)");
+
+        constexpr I2cTiming timing = SolveTiming(_ClockFreq, _SclFreq, _RiseTime, _FallTime);
+        static_assert(timing.Valid, "I2C SCL frequency is not achievable with given kernel clock");
+
+        _ClockCtrl::Enable();
+
+        if constexpr (_SclFreq > 400000)
+            EnableFastModePlus();
+
+        ApplyTiming(timing.Value());
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::ApplyTiming(uint32_t timing)
+    {
         _Regs()->CR1 &= ~I2C_CR1_PE;
         while (_Regs()->CR1 & I2C_CR1_PE) {};
 
-        _Regs()->TIMINGR = CalcTiming(_ClockCtrl::ClockFreq(), i2cClockSpeed);
+        _Regs()->TIMINGR = timing;
         _Regs()->CR1 |= I2C_CR1_PE;
 
         while ((_Regs()->CR1 & I2C_CR1_PE) == 0) {};
@@ -443,6 +576,154 @@ namespace Zhele
             | (size << I2C_CR2_NBYTES_Pos)
             | (isLast ? 0 : I2C_CR2_RELOAD);
     }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::StartNext()
+    {
+        // Called by producer only when queue is idle (so there is no concurrent interrupt)
+        // and from interrupt after transaction completion
+        if(_queue.empty())
+        {
+            _busy = false;
+            return;
+        }
+
+        _busy = true;
+        _status = I2cStatus::Success;
+
+        NVIC_EnableIRQ(_EventIrqNumber);
+        if constexpr(_EventIrqNumber != _ErrorIrqNumber)
+        {
+            NVIC_EnableIRQ(_ErrorIrqNumber);
+        }
+
+        const I2cTransaction& transaction = _queue.front();
+        _Regs()->ICR = I2C_ICR_STOPCF | I2C_ICR_NACKCF | I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF;
+        _Regs()->CR1 |= I2C_CR1_TCIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_ERRIE;
+        StartPhase(transaction.WriteSize == 0 && transaction.ReadSize > 0);
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::StartPhase(bool read)
+    {
+        const I2cTransaction& transaction = _queue.front();
+        uint16_t size = read ? transaction.ReadSize : transaction.WriteSize;
+        uint16_t chunk = size > 255 ? 255 : size;
+
+        _reading = read;
+        _index = 0;
+        _unprogrammed = size - chunk;
+
+        uint32_t control = _Regs()->CR1 & ~(I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+        if(size > 0)
+        {
+            if constexpr(HasDma)
+            {
+                // DMA moves whole phase, NBYTES is reloaded by 255-byte chunks on TCR event
+                if(read)
+                {
+                    _DmaRx::ClearFlags();
+                    _DmaRx::SetTransferCallback(nullptr);
+                    _DmaRx::Transfer(_DmaRx::Periph2Mem | _DmaRx::MemIncrement, transaction.ReadBuffer, &_Regs()->RXDR, size);
+                    control |= I2C_CR1_RXDMAEN;
+                }
+                else
+                {
+                    _DmaTx::ClearFlags();
+                    _DmaTx::SetTransferCallback(nullptr);
+                    _DmaTx::Transfer(_DmaTx::Mem2Periph | _DmaTx::MemIncrement, transaction.WriteBuffer, &_Regs()->TXDR, size);
+                    control |= I2C_CR1_TXDMAEN;
+                }
+            }
+            else
+            {
+                control |= read ? I2C_CR1_RXIE : I2C_CR1_TXIE;
+            }
+        }
+        _Regs()->CR1 = control;
+
+        // Software end mode: TC event starts read phase (repeated start) or generates STOP
+        _Regs()->CR2 = (transaction.DevAddr << 1)
+            | (read ? I2C_CR2_RD_WRN : 0)
+            | (chunk << I2C_CR2_NBYTES_Pos)
+            | (_unprogrammed > 0 ? I2C_CR2_RELOAD : 0)
+            | I2C_CR2_START;
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::EventIrqHandler()
+    {
+        if constexpr(_EventIrqNumber == _ErrorIrqNumber)
+        {
+            ErrorIrqHandler();
+        }
+
+        if(!_busy)
+            return;
+
+        const I2cTransaction& transaction = _queue.front();
+        uint32_t status = _Regs()->ISR;
+
+        if(status & I2C_ISR_NACKF)
+        {
+            _Regs()->ICR = I2C_ICR_NACKCF;
+            _Regs()->CR1 &= ~(I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+            _status = I2cStatus::Nack;
+            if(!(status & I2C_ISR_STOPF) && !(_Regs()->CR2 & I2C_CR2_STOP))
+                _Regs()->CR2 |= I2C_CR2_STOP;
+        }
+
+        if constexpr(!HasDma)
+        {
+            if((status & I2C_ISR_TXIS) && !_reading && _index < transaction.WriteSize)
+                _Regs()->TXDR = transaction.WriteBuffer[_index++];
+
+            if((status & I2C_ISR_RXNE) && _reading && _index < transaction.ReadSize)
+                transaction.ReadBuffer[_index++] = static_cast<uint8_t>(_Regs()->RXDR);
+        }
+
+        if(status & I2C_ISR_TCR)
+        {
+            uint16_t chunk = _unprogrammed > 255 ? 255 : _unprogrammed;
+            _unprogrammed -= chunk;
+            SetTransferSize(static_cast<uint8_t>(chunk), _unprogrammed == 0);
+        }
+
+        if((status & I2C_ISR_TC) && _status == I2cStatus::Success)
+        {
+            if(!_reading && transaction.ReadSize > 0)
+                StartPhase(true);
+            else
+                _Regs()->CR2 |= I2C_CR2_STOP;
+        }
+
+        if(status & I2C_ISR_STOPF)
+        {
+            _Regs()->ICR = I2C_ICR_STOPCF;
+            Finish(_status);
+        }
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::ErrorIrqHandler()
+    {
+        uint32_t status = _Regs()->ISR;
+        uint32_t errors = status & (I2C_ISR_BERR | I2C_ISR_ARLO | I2C_ISR_OVR);
+        if(errors == 0)
+            return;
+
+        // Error flags have the same positions in ICR
+        _Regs()->ICR = errors;
+        if(!_busy)
+            return;
+
+        // Software reset releases lines and clears transfer state
+        _Regs()->CR1 &= ~I2C_CR1_PE;
+        while (_Regs()->CR1 & I2C_CR1_PE) {};
+        _Regs()->CR1 |= I2C_CR1_PE;
+
+        Finish(GetErorFromEvent(status));
+    }
     #endif
     #if defined (I2C_TYPE_2)
         template<typename _Regs>
@@ -814,6 +1095,225 @@ namespace Zhele
         {
             return (_Regs()->SR1 | _Regs()->SR2 << 16) & 0x00ffffff;
         }
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::StartNext()
+        {
+            // Called by producer only when queue is idle (so there is no concurrent interrupt)
+            // and from interrupt after transaction completion
+            if(_queue.empty())
+            {
+                _busy = false;
+                return;
+            }
+
+            _busy = true;
+
+            // CR1 must not be written until previous STOP is generated
+            while(_Regs()->CR1 & I2C_CR1_STOP) {};
+
+            const I2cTransaction& transaction = _queue.front();
+            _reading = transaction.WriteSize == 0 && transaction.ReadSize > 0;
+            _index = 0;
+
+            _Regs()->CR2 |= I2C_CR2_ITEVTEN | I2C_CR2_ITERREN;
+            // POS is left set by two bytes read (or its error)
+            _Regs()->CR1 = (_Regs()->CR1 & ~I2C_CR1_POS) | I2C_CR1_ACK | I2C_CR1_START;
+        }
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::AddressSent()
+        {
+            const I2cTransaction& transaction = _queue.front();
+
+            if(_reading)
+            {
+                if(transaction.ReadSize == 1)
+                {
+                    // Single byte: NACK and STOP must be programmed before ADDR is cleared
+                    _Regs()->CR1 &= ~I2C_CR1_ACK;
+                    static_cast<void>(_Regs()->SR2);
+                    _Regs()->CR1 |= I2C_CR1_STOP;
+                    _Regs()->CR2 |= I2C_CR2_ITBUFEN;
+                    return;
+                }
+
+                if(transaction.ReadSize == 2)
+                {
+                    // Two bytes: with POS set ACK bit applies to next (second) byte, so NACK and POS
+                    // must be programmed before ADDR is cleared. Both bytes are read on BTF
+                    // (second one waits in shift register)
+                    _Regs()->CR1 = (_Regs()->CR1 & ~I2C_CR1_ACK) | I2C_CR1_POS;
+                    static_cast<void>(_Regs()->SR2);
+                    return;
+                }
+
+                if constexpr(HasDma)
+                {
+                    // LAST makes I2C send NACK after last byte received by DMA
+                    _DmaRx::ClearFlags();
+                    _DmaRx::SetTransferCallback(ReadCompleted);
+                    _DmaRx::Transfer(_DmaRx::Periph2Mem | _DmaRx::MemIncrement, transaction.ReadBuffer, &_Regs()->DR, transaction.ReadSize);
+                    _Regs()->CR2 |= I2C_CR2_DMAEN | I2C_CR2_LAST;
+                    _index = transaction.ReadSize;
+                }
+                else
+                {
+                    _Regs()->CR2 |= I2C_CR2_ITBUFEN;
+                }
+                static_cast<void>(_Regs()->SR2);
+                return;
+            }
+
+            if(transaction.WriteSize == 0)
+            {
+                static_cast<void>(_Regs()->SR2);
+                WriteCompleted();
+                return;
+            }
+
+            if constexpr(HasDma)
+            {
+                _DmaTx::ClearFlags();
+                _DmaTx::SetTransferCallback(nullptr);
+                _DmaTx::Transfer(_DmaTx::Mem2Periph | _DmaTx::MemIncrement, transaction.WriteBuffer, &_Regs()->DR, transaction.WriteSize);
+                _Regs()->CR2 |= I2C_CR2_DMAEN;
+                _index = transaction.WriteSize;
+            }
+            else
+            {
+                _Regs()->CR2 |= I2C_CR2_ITBUFEN;
+            }
+            static_cast<void>(_Regs()->SR2);
+        }
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::WriteCompleted()
+        {
+            const I2cTransaction& transaction = _queue.front();
+            _Regs()->CR2 &= ~(I2C_CR2_DMAEN | I2C_CR2_ITBUFEN);
+
+            if(transaction.ReadSize > 0)
+            {
+                // Repeated start, SB event continues transaction
+                _reading = true;
+                _index = 0;
+                _Regs()->CR1 |= I2C_CR1_ACK | I2C_CR1_START;
+                return;
+            }
+
+            _Regs()->CR1 |= I2C_CR1_STOP;
+            Finish(I2cStatus::Success);
+        }
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::ReadCompleted(void*, unsigned, bool success)
+        {
+            _Regs()->CR2 &= ~(I2C_CR2_DMAEN | I2C_CR2_LAST);
+            _Regs()->CR1 |= I2C_CR1_STOP;
+            Finish(success ? I2cStatus::Success : I2cStatus::BusError);
+        }
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::EventIrqHandler()
+        {
+            if constexpr(_EventIrqNumber == _ErrorIrqNumber)
+            {
+                ErrorIrqHandler();
+            }
+
+            if(!_busy)
+                return;
+
+            const I2cTransaction& transaction = _queue.front();
+            uint32_t status = _Regs()->SR1;
+
+            if(status & I2C_SR1_SB)
+            {
+                _Regs()->DR = (transaction.DevAddr << 1) | (_reading ? 1 : 0);
+                return;
+            }
+
+            if(status & I2C_SR1_ADDR)
+            {
+                AddressSent();
+                return;
+            }
+
+            if(_reading && transaction.ReadSize == 2)
+            {
+                if(status & I2C_SR1_BTF)
+                {
+                    _Regs()->CR1 |= I2C_CR1_STOP;
+                    transaction.ReadBuffer[0] = static_cast<uint8_t>(_Regs()->DR);
+                    transaction.ReadBuffer[1] = static_cast<uint8_t>(_Regs()->DR);
+                    Finish(I2cStatus::Success);
+                }
+                return;
+            }
+
+            if(_reading)
+            {
+                // Interrupt mode (single byte or I2C without DMA)
+                if((status & I2C_SR1_RXNE) && _index < transaction.ReadSize)
+                {
+                    transaction.ReadBuffer[_index++] = static_cast<uint8_t>(_Regs()->DR);
+                    uint16_t remaining = transaction.ReadSize - _index;
+
+                    if(remaining == 1)
+                    {
+                        // Last byte is being received now
+                        _Regs()->CR1 &= ~I2C_CR1_ACK;
+                        _Regs()->CR1 |= I2C_CR1_STOP;
+                    }
+                    if(remaining == 0)
+                    {
+                        _Regs()->CR2 &= ~I2C_CR2_ITBUFEN;
+                        Finish(I2cStatus::Success);
+                    }
+                }
+                return;
+            }
+
+            if((status & I2C_SR1_TXE) && _index < transaction.WriteSize)
+            {
+                _Regs()->DR = transaction.WriteBuffer[_index++];
+                if(_index == transaction.WriteSize)
+                    _Regs()->CR2 &= ~I2C_CR2_ITBUFEN;
+                return;
+            }
+
+            if(status & I2C_SR1_BTF)
+            {
+                // BTF while DMA still feeds data register means DMA is late
+                if constexpr(HasDma)
+                {
+                    if(_DmaTx::RemainingTransfers() != 0)
+                        return;
+                }
+                WriteCompleted();
+            }
+        }
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::ErrorIrqHandler()
+        {
+            uint32_t status = _Regs()->SR1;
+            uint32_t errors = status & (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR);
+            if(errors == 0)
+                return;
+
+            // Error flags are cleared by writing zero
+            _Regs()->SR1 = ~errors & 0xffff;
+            if(status & I2C_SR1_AF)
+                _Regs()->CR1 |= I2C_CR1_STOP;
+
+            if(!_busy)
+                return;
+
+            _Regs()->CR2 &= ~(I2C_CR2_DMAEN | I2C_CR2_LAST | I2C_CR2_ITBUFEN);
+            Finish(GetErorFromEvent(status));
+        }
     #endif
         I2C_TEMPLATE_ARGS
         bool I2C_TEMPLATE_QUALIFIER::WaitWhileBusy()
@@ -863,6 +1363,55 @@ namespace Zhele
             }
             return I2cStatus::Timeout;
         }
+
+        I2C_TEMPLATE_ARGS
+        bool I2C_TEMPLATE_QUALIFIER::Enqueue(const I2cTransaction& transaction)
+        {
+            if(!_queue.push_back(transaction))
+                return false;
+
+            if(!_busy)
+                StartNext();
+
+            return true;
+        }
+
+        I2C_TEMPLATE_ARGS
+        size_t I2C_TEMPLATE_QUALIFIER::Pending()
+        {
+            return _queue.size();
+        }
+
+        I2C_TEMPLATE_ARGS
+        bool I2C_TEMPLATE_QUALIFIER::Idle()
+        {
+            return !_busy && _queue.empty();
+        }
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::Finish(I2cStatus status)
+        {
+        #if defined (I2C_TYPE_1)
+            _Regs()->CR1 &= ~(I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_TCIE | I2C_CR1_STOPIE
+                | I2C_CR1_NACKIE | I2C_CR1_ERRIE | I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+        #endif
+        #if defined (I2C_TYPE_2)
+            _Regs()->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITERREN | I2C_CR2_ITBUFEN | I2C_CR2_DMAEN | I2C_CR2_LAST);
+        #endif
+            if constexpr(HasDma)
+            {
+                _DmaTx::Disable();
+                _DmaRx::Disable();
+            }
+
+            I2cTransaction transaction = _queue.front();
+            _queue.pop_front();
+
+            if(transaction.OnComplete)
+                transaction.OnComplete(status);
+
+            StartNext();
+        }
     }
 }
 #endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_I2C_H
\ No newline at end of file
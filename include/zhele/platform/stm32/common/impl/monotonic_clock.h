@@ -0,0 +1,97 @@
+/**
+ * @file
+ * Monotonic clock methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_MONOTONIC_CLOCK_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_MONOTONIC_CLOCK_H
+
+namespace Zhele::Timers
+{
+    #define MONOTONIC_CLOCK_TEMPLATE_ARGS template<typename _Timer, unsigned _Channel>
+    #define MONOTONIC_CLOCK_TEMPLATE_QUALIFIER MonotonicClock<_Timer, _Channel>
+
+    MONOTONIC_CLOCK_TEMPLATE_ARGS
+    void MONOTONIC_CLOCK_TEMPLATE_QUALIFIER::Init(unsigned tickFrequency)
+    {
+        _frequency = tickFrequency;
+
+        _Timer::Enable();
+        _Timer::SetPrescaler(_Timer::GetClockFreq() / tickFrequency - 1);
+        // Update event loads prescaler and resets counter
+        _Timer::SetPeriodAndUpdate(std::numeric_limits<Counter>::max());
+
+        _epoch = 0;
+        _high = 0;
+        Compare::SetPulse(HalfPeriod);
+        Compare::ClearInterruptFlag();
+        Compare::EnableInterrupt();
+        _Timer::Start();
+    }
+
+    MONOTONIC_CLOCK_TEMPLATE_ARGS
+    unsigned MONOTONIC_CLOCK_TEMPLATE_QUALIFIER::Frequency()
+    {
+        return _frequency;
+    }
+
+    MONOTONIC_CLOCK_TEMPLATE_ARGS
+    typename MONOTONIC_CLOCK_TEMPLATE_QUALIFIER::Ticks MONOTONIC_CLOCK_TEMPLATE_QUALIFIER::Now()
+    {
+        uint32_t high;
+        uint32_t epoch;
+        Counter counter;
+        // Handler has run between reads (reader has been preempted): read again
+        do
+        {
+            high = _high;
+            epoch = _epoch;
+            counter = _Timer::GetCounterValue();
+        } while(epoch != _epoch);
+
+        // Pending half period event is not counted yet: epoch parity differs from counter MSB
+        epoch += (epoch ^ (counter >> (CounterBits - 1))) & 1;
+        // The same for high word and epoch MSB
+        high += (high ^ (epoch >> 31)) & 1;
+
+        uint64_t halves = (uint64_t(high) << 31) | (epoch & (EpochHalfRange - 1));
+        return ((halves >> 1) << CounterBits) | counter;
+    }
+
+    MONOTONIC_CLOCK_TEMPLATE_ARGS
+    uint64_t MONOTONIC_CLOCK_TEMPLATE_QUALIFIER::NowNs()
+    {
+        return ToNanoseconds(Now());
+    }
+
+    MONOTONIC_CLOCK_TEMPLATE_ARGS
+    uint64_t MONOTONIC_CLOCK_TEMPLATE_QUALIFIER::ToNanoseconds(Ticks ticks)
+    {
+        // Split to avoid overflow of ticks * 10^9
+        return ticks / _frequency * 1000000000ull + ticks % _frequency * 1000000000ull / _frequency;
+    }
+
+    MONOTONIC_CLOCK_TEMPLATE_ARGS
+    void MONOTONIC_CLOCK_TEMPLATE_QUALIFIER::IRQHandler()
+    {
+        if(!Compare::IsInterrupt())
+            return;
+        Compare::ClearInterruptFlag();
+
+        // Epoch is stored before high word: reader which preempts handler between stores corrects high word
+        uint32_t epoch = _epoch + 1;
+        Compare::SetPulse(static_cast<Counter>((epoch + 1) * HalfPeriod));
+        _epoch = epoch;
+        if((epoch & (EpochHalfRange - 1)) == 0)
+            _high = _high + 1;
+    }
+
+    #undef MONOTONIC_CLOCK_TEMPLATE_ARGS
+    #undef MONOTONIC_CLOCK_TEMPLATE_QUALIFIER
+}
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_MONOTONIC_CLOCK_H
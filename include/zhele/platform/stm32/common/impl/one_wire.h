@@ -36,7 +36,8 @@ namespace Zhele
         volatile bool complete = false;
         uint8_t precenseBit = 0;
 
-        _Usart::EnableAsyncRead(&precenseBit, 1, [&complete](void*, unsigned, bool){complete = true;});
+        auto onComplete = [&complete](void*, unsigned, bool){complete = true;};
+        _Usart::EnableAsyncRead(&precenseBit, 1, onComplete);
         _Usart::Write(0xf0);
         while (!complete);
 
@@ -54,7 +55,8 @@ namespace Zhele
         volatile bool complete = false;
 
         // Send byte async, receive because it's half-duplex
-        _Usart::EnableAsyncRead(dummyBuffer, 8, [&complete](void*, unsigned, bool){complete = true;});
+        auto onComplete = [&complete](void*, unsigned, bool){complete = true;};
+        _Usart::EnableAsyncRead(dummyBuffer, 8, onComplete);
         _Usart::Write(buffer, 8, true);
 
         while(!complete);
@@ -66,10 +68,10 @@ namespace Zhele
         uint8_t buffer[8];
         volatile bool readComplete = false;            
 
-        _Usart::EnableAsyncRead(buffer, 8,
-                        [&readComplete](void* data, unsigned size, bool success){
-                            readComplete = true;});
-        
+        // Lambda is bound by reference, it lives until transfer completes
+        auto onComplete = [&readComplete](void*, unsigned, bool){readComplete = true;};
+        _Usart::EnableAsyncRead(buffer, 8, onComplete);
+
         _Usart::WriteAsync(_readDummyBuffer, 8);
 
         while (!readComplete){}
@@ -0,0 +1,264 @@
+/**
+ * @file
+ * GPIO configuration aggregator methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_PIN_CONFIGURATION_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_PIN_CONFIGURATION_H
+
+namespace Zhele::IO
+{
+    namespace Private
+    {
+        /**
+         * @brief Pins of settings (single pin or pins of pin list)
+         */
+        template<typename _Pin>
+        struct SettingsPins
+        {
+            static constexpr auto Pins = template_utils::type_list<_Pin>{};
+            static constexpr auto Ports = template_utils::type_list<typename _Pin::Port>{};
+        };
+
+        template<typename... _Pins>
+        struct SettingsPins<PinList<_Pins...>>
+        {
+            static constexpr auto Pins = template_utils::type_list<_Pins...>{};
+            static constexpr auto Ports = template_utils::type_list<typename _Pins::Port...>{};
+        };
+
+        /**
+         * @brief Merges setting of pin
+         *
+         * @param [in, out] target Merged setting
+         * @param [in] value New setting (negative if not given)
+         * @param [in, out] conflict Conflict flag
+         *
+         * @par Returns
+         *	Nothing
+         */
+        constexpr void MergeAttribute(int8_t& target, int8_t value, bool& conflict)
+        {
+            if(value < 0)
+                return;
+            if(target >= 0 && target != value)
+                conflict = true;
+            target = value;
+        }
+
+        template<typename _Pins, auto _Configuration, auto... _Options>
+        struct PinSettingsTraits<PinSettings<_Pins, _Configuration, _Options...>>
+        {
+            static constexpr auto Flatten = template_utils::type_list<PinSettings<_Pins, _Configuration, _Options...>>{};
+            static constexpr auto Ports = SettingsPins<_Pins>::Ports;
+
+            /**
+             * @brief Adds settings of pins of given port
+             *
+             * @tparam _Port Port
+             * @param [in, out] port Port pins settings
+             *
+             * @par Returns
+             *	Nothing
+             */
+            template<typename _Port>
+            static constexpr void Collect(PortAttributes& port)
+            {
+                constexpr PinAttributes attributes = MakeAttributes<_Port>();
+                [&]<typename... _Pin>(template_utils::type_list<_Pin...>) {
+                    ([&] {
+                        if constexpr (std::is_same_v<typename _Pin::Port, _Port>)
+                        {
+                            PinAttributes& pin = port.Pins[_Pin::Number];
+                            MergeAttribute(pin.Configuration, attributes.Configuration, port.Conflict);
+                            MergeAttribute(pin.Driver, attributes.Driver, port.Conflict);
+                            MergeAttribute(pin.Pull, attributes.Pull, port.Conflict);
+                            MergeAttribute(pin.Speed, attributes.Speed, port.Conflict);
+                            MergeAttribute(pin.AltFunc, attributes.AltFunc, port.Conflict);
+                        }
+                    }(), ...);
+                }(SettingsPins<_Pins>::Pins);
+            }
+
+        private:
+            template<typename _Port>
+            static consteval PinAttributes MakeAttributes()
+            {
+                static_assert(std::is_same_v<decltype(_Configuration), typename _Port::Configuration>,
+                    "Pin configuration should be Configuration enum of pin port");
+
+                PinAttributes attributes {};
+                attributes.Configuration = static_cast<int8_t>(_Configuration);
+                ([&] {
+                    using Option = decltype(_Options);
+                    if constexpr (std::is_same_v<Option, typename _Port::DriverType>)
+                        attributes.Driver = static_cast<int8_t>(_Options);
+                    else if constexpr (std::is_same_v<Option, typename _Port::PullMode>)
+                        attributes.Pull = static_cast<int8_t>(_Options);
+                    else if constexpr (std::is_same_v<Option, typename _Port::Speed>)
+                        attributes.Speed = static_cast<int8_t>(_Options);
+                    else
+                    {
+                        static_assert(std::is_integral_v<Option>, "Pin option should be driver type, pull mode, speed or alternate function number");
+                        attributes.AltFunc = static_cast<int8_t>(_Options);
+                    }
+                }(), ...);
+                return attributes;
+            }
+        };
+
+        template<typename... _Settings>
+        struct PinSettingsTraits<template_utils::type_list<_Settings...>>
+        {
+            static constexpr auto Flatten = (template_utils::type_list<>{} + ... + PinSettingsTraits<_Settings>::Flatten);
+        };
+
+        /**
+         * @brief Folds settings of port pins into registers values
+         *
+         * @param [in] port Port pins settings
+         *
+         * @returns Registers values
+         */
+        constexpr PortConfigurationImage MakePortImage(const PortAttributes& port)
+        {
+            PortConfigurationImage image {};
+            image.Conflict = port.Conflict;
+
+            for(unsigned pin = 0; pin < 16; ++pin)
+            {
+                const PinAttributes& attributes = port.Pins[pin];
+                if(attributes.Configuration < 0)
+                    continue;
+            #if defined(GPIO_CRL_MODE0)
+                // CNF[1:0] MODE[1:0]: mode is speed of output, CNF0 is open-drain for output and floating for input
+                uint32_t config = attributes.Configuration;
+                if(config & 0x03)
+                {
+                    if(attributes.Speed >= 0)
+                        config = (config & ~0x03u) | attributes.Speed;
+                    if(attributes.Driver >= 0)
+                        config = (config & ~0x04u) | attributes.Driver;
+                }
+                else if(config == NativePortBase::In && attributes.Pull > 0)
+                {
+                    // Input with pull-up/pull-down (CNF = 10), direction of pull is selected by ODR
+                    config = 0x08;
+                    image.Bsrr |= (attributes.Pull & 0x10) ? (1u << (pin + 16)) : (1u << pin);
+                }
+
+                const unsigned shift = (pin % 8) * 4;
+                uint32_t& mask = pin < 8 ? image.CrlMask : image.CrhMask;
+                uint32_t& value = pin < 8 ? image.Crl : image.Crh;
+                mask |= 0x0fu << shift;
+                value |= config << shift;
+            #else
+                const unsigned shift = pin * 2;
+                image.ModerMask |= 0x03u << shift;
+                image.Moder |= uint32_t(attributes.Configuration) << shift;
+                if(attributes.Driver >= 0)
+                {
+                    image.OtyperMask |= 1u << pin;
+                    image.Otyper |= uint32_t(attributes.Driver) << pin;
+                }
+                if(attributes.Speed >= 0)
+                {
+                    image.OspeedrMask |= 0x03u << shift;
+                    image.Ospeedr |= uint32_t(attributes.Speed) << shift;
+                }
+                if(attributes.Pull >= 0)
+                {
+                    image.PupdrMask |= 0x03u << shift;
+                    image.Pupdr |= uint32_t(attributes.Pull) << shift;
+                }
+                if(attributes.AltFunc >= 0)
+                {
+                    image.AfrMask[pin / 8] |= 0x0fu << ((pin % 8) * 4);
+                    image.Afr[pin / 8] |= uint32_t(attributes.AltFunc & 0x0f) << ((pin % 8) * 4);
+                }
+            #endif
+            }
+            return image;
+        }
+
+        /**
+         * @brief Writes configured bits of register
+         *
+         * @details
+         * Register is written without read if all its bits are configured.
+         *
+         * @tparam _Mask Configured bits
+         * @tparam _Value Value of configured bits
+         * @tparam _Full Mask of all register bits
+         * @param [in, out] reg Register
+         *
+         * @par Returns
+         *	Nothing
+         */
+        template<uint32_t _Mask, uint32_t _Value, uint32_t _Full = 0xffffffff>
+        inline void WriteConfigurationRegister(volatile uint32_t& reg)
+        {
+            if constexpr ((_Mask & _Full) == _Full)
+                reg = _Value;
+            else if constexpr (_Mask != 0)
+                reg = (reg & ~_Mask) | _Value;
+        }
+    }
+
+    template<typename... _Settings>
+    template<typename _Port>
+    consteval PortConfigurationImage PinConfiguration<_Settings...>::MakeImage()
+    {
+        Private::PortAttributes port {};
+        [&]<typename... _Setting>(template_utils::type_list<_Setting...>) {
+            (Private::PinSettingsTraits<_Setting>::template Collect<_Port>(port), ...);
+        }(_settings);
+        return Private::MakePortImage(port);
+    }
+
+    template<typename... _Settings>
+    consteval bool PinConfiguration<_Settings...>::HasConflicts()
+    {
+        return []<typename... _Port>(template_utils::type_list<_Port...>) {
+            return (false || ... || Image<_Port>.Conflict);
+        }(_ports);
+    }
+
+    template<typename... _Settings>
+    void PinConfiguration<_Settings...>::Apply()
+    {
+        static_assert(!HasConflicts(), "Some pin has different settings");
+
+        []<typename... _Port>(template_utils::type_list<_Port...>) {
+            ((_Port::Enable(), WriteImage<_Port>()), ...);
+        }(_ports);
+    }
+
+    template<typename... _Settings>
+    template<typename _Port>
+    void PinConfiguration<_Settings...>::WriteImage()
+    {
+        static constexpr PortConfigurationImage image = Image<_Port>;
+        using Regs = typename _Port::Regs;
+
+    #if defined(GPIO_CRL_MODE0)
+        Private::WriteConfigurationRegister<image.CrlMask, image.Crl>(Regs()->CRL);
+        Private::WriteConfigurationRegister<image.CrhMask, image.Crh>(Regs()->CRH);
+        if constexpr (image.Bsrr != 0)
+            Regs()->BSRR = image.Bsrr;
+    #else
+        Private::WriteConfigurationRegister<image.ModerMask, image.Moder>(Regs()->MODER);
+        Private::WriteConfigurationRegister<image.OtyperMask, image.Otyper, 0x0000ffff>(Regs()->OTYPER);
+        Private::WriteConfigurationRegister<image.OspeedrMask, image.Ospeedr>(Regs()->OSPEEDR);
+        Private::WriteConfigurationRegister<image.PupdrMask, image.Pupdr>(Regs()->PUPDR);
+        Private::WriteConfigurationRegister<image.AfrMask[0], image.Afr[0]>(Regs()->AFR[0]);
+        Private::WriteConfigurationRegister<image.AfrMask[1], image.Afr[1]>(Regs()->AFR[1]);
+    #endif
+    }
+}
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_PIN_CONFIGURATION_H
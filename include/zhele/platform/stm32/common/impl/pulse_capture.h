@@ -0,0 +1,123 @@
+/**
+ * @file
+ * Pulse capture methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_PULSE_CAPTURE_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_PULSE_CAPTURE_H
+
+#include <limits>
+
+namespace Zhele::Timers
+{
+    #define PULSE_CAPTURE_TEMPLATE_ARGS template<typename _Timer, typename _DmaChannel, unsigned _Size, unsigned _Frames, unsigned _TimeoutChannel>
+    #define PULSE_CAPTURE_TEMPLATE_QUALIFIER PulseCapture<_Timer, _DmaChannel, _Size, _Frames, _TimeoutChannel>
+
+    PULSE_CAPTURE_TEMPLATE_ARGS
+    void PULSE_CAPTURE_TEMPLATE_QUALIFIER::Init(unsigned tickFrequency, Counter gap, Edges edges ONLY_IF_STREAM_SUPPORTED(COMMA uint8_t channel))
+    {
+        using SlaveMode = typename _Timer::SlaveMode;
+
+        _Timer::Enable();
+        _Timer::SetPrescaler(_Timer::GetClockFreq() / tickFrequency - 1);
+        // Update event loads prescaler
+        _Timer::SetPeriodAndUpdate(std::numeric_limits<Counter>::max());
+
+        // Capture channel latches counter before reset by the same edge
+        if(edges == Edges::Both)
+        {
+            SlaveMode::SelectTrigger(SlaveMode::Trigger::Ti1EdgeDetector);
+            Capture::SetCaptureMode(Capture::CaptureMode::CaptureTrc);
+        }
+        else
+        {
+            SlaveMode::SelectTrigger(SlaveMode::Trigger::FilteredTimerInput1);
+            Capture::SetCaptureMode(Capture::CaptureMode::Direct);
+        }
+        Capture::SetCapturePolarity(edges == Edges::Falling ? Capture::CapturePolarity::FallingEdge : Capture::CapturePolarity::RisingEdge);
+        SlaveMode::EnableSlaveMode(SlaveMode::Mode::ResetMode);
+
+        _gap = gap;
+        _frameStart = 0;
+        _dropped = 0;
+        _frames.clear();
+        Timeout::SetPulse(gap);
+        Timeout::DisableInterrupt();
+
+        Dma::Start(_buffer, _Size ONLY_IF_STREAM_SUPPORTED(COMMA channel));
+        Capture::Enable();
+        WaitFirstEdge();
+        _Timer::Start();
+    }
+
+    PULSE_CAPTURE_TEMPLATE_ARGS
+    bool PULSE_CAPTURE_TEMPLATE_QUALIFIER::ReadFrame(Frame& frame)
+    {
+        if(_frames.empty())
+            return false;
+
+        frame = _frames.front();
+        _frames.pop_front();
+        return true;
+    }
+
+    PULSE_CAPTURE_TEMPLATE_ARGS
+    uint32_t PULSE_CAPTURE_TEMPLATE_QUALIFIER::DroppedFrames()
+    {
+        return _dropped;
+    }
+
+    PULSE_CAPTURE_TEMPLATE_ARGS
+    void PULSE_CAPTURE_TEMPLATE_QUALIFIER::IRQHandler()
+    {
+        // Capture flag is not checked: DMA read of capture register clears it
+        if(!_armed)
+        {
+            Capture::DisableInterrupt();
+            Timeout::ClearInterruptFlag();
+            Timeout::EnableInterrupt();
+            _armed = true;
+            return;
+        }
+
+        if(!Timeout::IsInterrupt())
+            return;
+        Timeout::ClearInterruptFlag();
+
+        uint16_t end = Dma::Position();
+        // Edge after timeout match has reset counter: it is the first edge of next frame
+        bool nextFrame = _Timer::GetCounterValue() < _gap;
+        if(nextFrame)
+            end = (end - 1) & Mask;
+
+        Frame frame;
+        frame._start = _frameStart;
+        frame._edges = (end - _frameStart) & Mask;
+        if(frame._edges > 1 && !_frames.push_back(frame))
+            ++_dropped;
+        _frameStart = end;
+
+        if(!nextFrame)
+        {
+            Timeout::DisableInterrupt();
+            WaitFirstEdge();
+        }
+    }
+
+    PULSE_CAPTURE_TEMPLATE_ARGS
+    void PULSE_CAPTURE_TEMPLATE_QUALIFIER::WaitFirstEdge()
+    {
+        _armed = false;
+        Capture::ClearInterruptFlag();
+        Capture::EnableInterrupt();
+    }
+
+    #undef PULSE_CAPTURE_TEMPLATE_ARGS
+    #undef PULSE_CAPTURE_TEMPLATE_QUALIFIER
+}
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_PULSE_CAPTURE_H
@@ -0,0 +1,272 @@
+/**
+ * @file
+ * Software I2C methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_SOFT_I2C_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_SOFT_I2C_H
+
+namespace Zhele
+{
+    #define SOFT_I2C_TEMPLATE_ARGS template<typename _SclPin, typename _SdaPin, unsigned long _CoreFreq>
+    #define SOFT_I2C_TEMPLATE_QUALIFIER SoftI2c<_SclPin, _SdaPin, _CoreFreq>
+
+    SOFT_I2C_TEMPLATE_ARGS
+    void SOFT_I2C_TEMPLATE_QUALIFIER::Init(uint32_t i2cClockSpeed)
+    {
+        _SclPin::Port::Enable();
+        _SdaPin::Port::Enable();
+        CycleCounter::Enable();
+
+        // Released lines (high) before switching to output
+        _SclPin::Set();
+        _SdaPin::Set();
+        _SclPin::SetConfiguration(_SclPin::Configuration::Out);
+        _SclPin::SetDriverType(_SclPin::DriverType::OpenDrain);
+        _SdaPin::SetConfiguration(_SdaPin::Configuration::Out);
+        _SdaPin::SetDriverType(_SdaPin::DriverType::OpenDrain);
+
+        _halfPeriod = _CoreFreq / (2 * i2cClockSpeed);
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    template<uint32_t _SclFreq>
+    void SOFT_I2C_TEMPLATE_QUALIFIER::Init()
+    {
+        static constexpr CycleCounter::Ticks halfPeriod = _CoreFreq / (2 * _SclFreq);
+        static_assert(halfPeriod > 0, "SCL frequency is higher than half of core clock");
+
+        Init(_SclFreq);
+        _halfPeriod = halfPeriod;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::WriteU8(uint16_t devAddr, uint16_t regAddr, uint8_t data, I2cOpts opts)
+    {
+        return Write(devAddr, regAddr, &data, 1, opts);
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::Write(uint16_t devAddr, uint16_t regAddr, const uint8_t* data, uint16_t size, I2cOpts opts)
+    {
+        I2cStatus status = WriteDevAddr(devAddr, false, opts, false);
+        if(status == I2cStatus::Success && !HasAllFlags(opts, I2cOpts::RegAddrNone))
+            status = WriteRegAddr(regAddr, opts);
+
+        for(uint16_t i = 0; i < size && status == I2cStatus::Success; ++i)
+            status = WriteByte(data[i]);
+
+        return Stop(status);
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    ReadResult SOFT_I2C_TEMPLATE_QUALIFIER::ReadU8(uint16_t devAddr, uint16_t regAddr, I2cOpts opts)
+    {
+        ReadResult result {};
+        result.Status = Read(devAddr, regAddr, &result.Value, 1, opts);
+        return result;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::Read(uint16_t devAddr, uint16_t regAddr, uint8_t* data, uint16_t size, I2cOpts opts)
+    {
+        I2cStatus status = I2cStatus::Success;
+        bool repeated = false;
+        if(!HasAllFlags(opts, I2cOpts::RegAddrNone))
+        {
+            status = WriteDevAddr(devAddr, false, opts, false);
+            if(status == I2cStatus::Success)
+                status = WriteRegAddr(regAddr, opts);
+            repeated = true;
+        }
+
+        if(status == I2cStatus::Success)
+            status = WriteDevAddr(devAddr, true, opts, repeated);
+
+        // Last byte is not acknowledged, so slave releases SDA for stop condition
+        for(uint16_t i = 0; i < size && status == I2cStatus::Success; ++i)
+            status = ReadByte(data[i], i + 1 < size);
+
+        return Stop(status);
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    bool SOFT_I2C_TEMPLATE_QUALIFIER::Busy()
+    {
+        return !_SclPin::IsSet() || !_SdaPin::IsSet();
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::Start(bool repeated)
+    {
+        _edge = CycleCounter::Now();
+        if(repeated)
+        {
+            // SCL is low after acknowledge bit: release SDA, then SCL
+            _SdaPin::Set();
+            CycleCounter::WaitPeriod(_edge, _halfPeriod);
+            if(I2cStatus status = ReleaseClock(); status != I2cStatus::Success)
+                return status;
+            CycleCounter::WaitPeriod(_edge, _halfPeriod);
+        }
+        else if(Busy())
+        {
+            return I2cStatus::Busy;
+        }
+
+        _SdaPin::Clear();
+        CycleCounter::WaitPeriod(_edge, _halfPeriod);
+        _SclPin::Clear();
+        return I2cStatus::Success;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::Stop(I2cStatus status)
+    {
+        // Bus is driven by other master
+        if(status == I2cStatus::ArbitrationError || status == I2cStatus::Busy)
+        {
+            _SclPin::Set();
+            _SdaPin::Set();
+            return status;
+        }
+
+        _SdaPin::Clear();
+        CycleCounter::WaitPeriod(_edge, _halfPeriod);
+        I2cStatus stopStatus = ReleaseClock();
+        CycleCounter::WaitPeriod(_edge, _halfPeriod);
+        _SdaPin::Set();
+        // Bus free time before next start
+        CycleCounter::WaitPeriod(_edge, _halfPeriod);
+
+        return status == I2cStatus::Success ? stopStatus : status;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::ReleaseClock()
+    {
+        _SclPin::Set();
+        if(_SclPin::IsSet())
+            return I2cStatus::Success;
+
+        // Clock stretching: high period starts when slave releases SCL
+        CycleCounter::Ticks start = CycleCounter::Now();
+        while(!_SclPin::IsSet())
+        {
+            if(CycleCounter::Elapsed(start) > StretchTimeout)
+                return I2cStatus::Timeout;
+        }
+        _edge = CycleCounter::Now();
+        return I2cStatus::Success;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::WriteBit(bool bit)
+    {
+        _SdaPin::Set(bit);
+        CycleCounter::WaitPeriod(_edge, _halfPeriod);
+        if(I2cStatus status = ReleaseClock(); status != I2cStatus::Success)
+            return status;
+
+        // Other master drives SDA low while this one sends high level
+        if(bit && !_SdaPin::IsSet())
+            return I2cStatus::ArbitrationError;
+
+        CycleCounter::WaitPeriod(_edge, _halfPeriod);
+        _SclPin::Clear();
+        return I2cStatus::Success;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::ReadBit(bool& bit)
+    {
+        _SdaPin::Set();
+        CycleCounter::WaitPeriod(_edge, _halfPeriod);
+        if(I2cStatus status = ReleaseClock(); status != I2cStatus::Success)
+            return status;
+
+        CycleCounter::WaitPeriod(_edge, _halfPeriod);
+        bit = _SdaPin::IsSet();
+        _SclPin::Clear();
+        return I2cStatus::Success;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::WriteByte(uint8_t data)
+    {
+        for(unsigned i = 0; i < 8; ++i)
+        {
+            if(I2cStatus status = WriteBit(data & (0x80 >> i)); status != I2cStatus::Success)
+                return status;
+        }
+
+        bool nack;
+        if(I2cStatus status = ReadBit(nack); status != I2cStatus::Success)
+            return status;
+
+        return nack ? I2cStatus::Nack : I2cStatus::Success;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::ReadByte(uint8_t& data, bool ack)
+    {
+        data = 0;
+        for(unsigned i = 0; i < 8; ++i)
+        {
+            bool bit;
+            if(I2cStatus status = ReadBit(bit); status != I2cStatus::Success)
+                return status;
+            data = (data << 1) | bit;
+        }
+
+        return WriteBit(!ack);
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::WriteDevAddr(uint16_t devAddr, bool read, I2cOpts opts, bool repeated)
+    {
+        I2cStatus status = Start(repeated);
+        if(status != I2cStatus::Success)
+            return status;
+
+        // Option values overlap (RegAddrNone = DevAddr10Bit | RegAddr16Bit), so they are compared as whole
+        if(opts != I2cOpts::DevAddr10Bit)
+            return WriteByte((devAddr << 1) | (read ? 1 : 0));
+
+        // 10-bit address: header with two high bits, then low byte.
+        // Read direction is selected by repeated start with header only.
+        const uint8_t header = 0xf0 | ((devAddr >> 7) & 0x06);
+        if(!read || !repeated)
+        {
+            status = WriteByte(header);
+            if(status == I2cStatus::Success)
+                status = WriteByte(static_cast<uint8_t>(devAddr));
+            if(status != I2cStatus::Success || !read)
+                return status;
+
+            status = Start(true);
+            if(status != I2cStatus::Success)
+                return status;
+        }
+        return WriteByte(header | 1);
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::WriteRegAddr(uint16_t regAddr, I2cOpts opts)
+    {
+        // Byte order is the same as hardware I2C has
+        I2cStatus status = WriteByte(static_cast<uint8_t>(regAddr));
+        if(status == I2cStatus::Success && opts == I2cOpts::RegAddr16Bit)
+            status = WriteByte(static_cast<uint8_t>(regAddr >> 8));
+        return status;
+    }
+}
+
+#undef SOFT_I2C_TEMPLATE_ARGS
+#undef SOFT_I2C_TEMPLATE_QUALIFIER
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_SOFT_I2C_H
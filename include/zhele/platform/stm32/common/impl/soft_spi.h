@@ -0,0 +1,186 @@
+/**
+ * @file
+ * Software SPI methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_SOFT_SPI_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_SOFT_SPI_H
+
+#include <cstring>
+#include <type_traits>
+
+namespace Zhele
+{
+    #define SOFT_SPI_TEMPLATE_ARGS template< \
+        typename _MosiPin, \
+        typename _MisoPin, \
+        typename _ClockPin, \
+        typename _SsPin, \
+        unsigned long _CoreFreq>
+
+    #define SOFT_SPI_TEMPLATE_QUALIFIER SoftSpi<_MosiPin, _MisoPin, _ClockPin, _SsPin, _CoreFreq>
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::Enable()
+    {
+        _MosiPin::Port::Enable();
+        _MisoPin::Port::Enable();
+        _ClockPin::Port::Enable();
+        _SsPin::Port::Enable();
+        CycleCounter::Enable();
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::Init(ClockDivider divider, [[maybe_unused]] Mode mode)
+    {
+        Enable();
+
+        SetDivider(divider);
+        SetClockPolarity(ClockPolarityLow);
+        SetClockPhase(ClockPhaseLeadingEdge);
+        SetBitOrder(MsbFirst);
+        SetDataSize(DataSize8);
+
+        _ClockPin::Clear();
+        _ClockPin::SetConfiguration(_ClockPin::Configuration::Out);
+        _ClockPin::SetDriverType(_ClockPin::DriverType::PushPull);
+        _MosiPin::SetConfiguration(_MosiPin::Configuration::Out);
+        _MosiPin::SetDriverType(_MosiPin::DriverType::PushPull);
+        _MisoPin::SetConfiguration(_MisoPin::Configuration::In);
+        _SsPin::Set();
+        _SsPin::SetConfiguration(_SsPin::Configuration::Out);
+        _SsPin::SetDriverType(_SsPin::DriverType::PushPull);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    template<unsigned long _ClockFreq>
+    void SOFT_SPI_TEMPLATE_QUALIFIER::Init()
+    {
+        static constexpr CycleCounter::Ticks halfPeriod = _CoreFreq / (2 * _ClockFreq);
+        static_assert(halfPeriod > 0, "SPI clock is higher than half of core clock");
+
+        Init();
+        _halfPeriod = halfPeriod;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SetDivider(ClockDivider divider)
+    {
+        _halfPeriod = HalfPeriod(divider);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SetClockPolarity(ClockPolarity clockPolarity)
+    {
+        _idleHigh = clockPolarity == ClockPolarityHigh;
+        _ClockPin::Set(_idleHigh);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SetClockPhase(ClockPhase clockPhase)
+    {
+        _sampleOnTrailingEdge = clockPhase == ClockPhaseFallingEdge;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SetBitOrder(BitOrder bitOrder)
+    {
+        _lsbFirst = bitOrder == LsbFirst;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SetDataSize(DataSize dataSize)
+    {
+        _frameBits = FrameBits(dataSize);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SetSS()
+    {
+        _SsPin::Set();
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::ClearSS()
+    {
+        _SsPin::Clear();
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    bool SOFT_SPI_TEMPLATE_QUALIFIER::Busy()
+    {
+        return false;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    uint16_t SOFT_SPI_TEMPLATE_QUALIFIER::Send(uint16_t value)
+    {
+        const unsigned bits = _frameBits;
+        const CycleCounter::Ticks halfPeriod = _halfPeriod;
+        uint16_t result = 0;
+
+        // Leading edge of CPHA = 0 samples data, so data is set half period before it
+        CycleCounter::Ticks edge = CycleCounter::Now();
+        for(unsigned i = 0; i < bits; ++i)
+        {
+            unsigned bit = _lsbFirst ? i : bits - 1 - i;
+
+            if(!_sampleOnTrailingEdge)
+                _MosiPin::Set((value >> bit) & 1);
+            CycleCounter::WaitPeriod(edge, halfPeriod);
+            _ClockPin::Set(!_idleHigh);
+
+            if(_sampleOnTrailingEdge)
+                _MosiPin::Set((value >> bit) & 1);
+            else
+                result |= uint16_t(_MisoPin::IsSet()) << bit;
+            CycleCounter::WaitPeriod(edge, halfPeriod);
+            _ClockPin::Set(_idleHigh);
+
+            if(_sampleOnTrailingEdge)
+                result |= uint16_t(_MisoPin::IsSet()) << bit;
+        }
+
+        return result;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    template<Private::SpiBase::DataSize _DataSize>
+    void SOFT_SPI_TEMPLATE_QUALIFIER::Transfer(const void* transmitBuffer, void* receiveBuffer, size_t count)
+    {
+        using Frame = std::conditional_t<(_DataSize > DataSize8), uint16_t, uint8_t>;
+        const uint8_t* transmit = static_cast<const uint8_t*>(transmitBuffer);
+        uint8_t* receive = static_cast<uint8_t*>(receiveBuffer);
+
+        for(size_t i = 0; i < count; ++i)
+        {
+            Frame value = static_cast<Frame>(0xffff);
+            if(transmit)
+                std::memcpy(&value, transmit + i * sizeof(Frame), sizeof(Frame));
+            value = static_cast<Frame>(Send(value));
+            if(receive)
+                std::memcpy(receive + i * sizeof(Frame), &value, sizeof(Frame));
+        }
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::Write(uint16_t data)
+    {
+        Send(data);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    uint16_t SOFT_SPI_TEMPLATE_QUALIFIER::Read()
+    {
+        return Send(0xffff);
+    }
+}
+
+#undef SOFT_SPI_TEMPLATE_ARGS
+#undef SOFT_SPI_TEMPLATE_QUALIFIER
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_SOFT_SPI_H
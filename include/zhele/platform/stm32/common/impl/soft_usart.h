@@ -0,0 +1,144 @@
+/**
+ * @file
+ * Software USART methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_SOFT_USART_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_SOFT_USART_H
+
+#include <bit>
+
+namespace Zhele
+{
+    #define SOFT_USART_TEMPLATE_ARGS template<typename _TxPin, typename _RxPin, unsigned long _CoreFreq>
+    #define SOFT_USART_TEMPLATE_QUALIFIER SoftUsart<_TxPin, _RxPin, _CoreFreq>
+
+    SOFT_USART_TEMPLATE_ARGS
+    template<unsigned long baud>
+    void SOFT_USART_TEMPLATE_QUALIFIER::Init(UsartMode mode)
+    {
+        static constexpr CycleCounter::Ticks bitTime = _CoreFreq / baud;
+        static_assert(bitTime > 1, "Baud rate is too high for core clock");
+
+        Init(baud, mode);
+        _bitTime = bitTime;
+    }
+
+    SOFT_USART_TEMPLATE_ARGS
+    void SOFT_USART_TEMPLATE_QUALIFIER::Init(unsigned baud, UsartMode mode)
+    {
+        _TxPin::Port::Enable();
+        _RxPin::Port::Enable();
+        CycleCounter::Enable();
+
+        SetBaud(baud);
+        SetConfig(mode);
+    }
+
+    SOFT_USART_TEMPLATE_ARGS
+    void SOFT_USART_TEMPLATE_QUALIFIER::SetConfig(UsartMode mode)
+    {
+        _dataBits = (mode.CR1 & UsartMode::DataBits9) ? 9 : 8;
+        _parity = (mode.CR1 & UsartMode::EvenParity) != 0;
+        _oddParity = (mode.CR1 & UsartMode::OddParity) == UsartMode::OddParity;
+        _stopBits = (mode.CR2 & UsartMode::TwoStopBits) ? 2 : 1;
+
+        if(mode.CR1 & UsartMode::TxEnable)
+        {
+            // Idle line is high
+            _TxPin::Set();
+            _TxPin::SetConfiguration(_TxPin::Configuration::Out);
+            _TxPin::SetDriverType(_TxPin::DriverType::PushPull);
+        }
+        if(mode.CR1 & UsartMode::RxEnable)
+        {
+            _RxPin::SetConfiguration(_RxPin::Configuration::In);
+            _RxPin::SetPullMode(_RxPin::PullMode::PullUp);
+        }
+    }
+
+    SOFT_USART_TEMPLATE_ARGS
+    void SOFT_USART_TEMPLATE_QUALIFIER::SetBaud(unsigned baud)
+    {
+        _bitTime = _CoreFreq / baud;
+    }
+
+    SOFT_USART_TEMPLATE_ARGS
+    bool SOFT_USART_TEMPLATE_QUALIFIER::ReadReady()
+    {
+        return !_RxPin::IsSet();
+    }
+
+    SOFT_USART_TEMPLATE_ARGS
+    uint8_t SOFT_USART_TEMPLATE_QUALIFIER::Read()
+    {
+        const CycleCounter::Ticks bitTime = _bitTime;
+        const unsigned frameBits = _dataBits;
+
+        while(_RxPin::IsSet());
+
+        // Bits are sampled in the middle
+        CycleCounter::Ticks edge = CycleCounter::Now();
+        CycleCounter::WaitPeriod(edge, bitTime / 2);
+
+        uint16_t frame = 0;
+        for(unsigned i = 0; i < frameBits; ++i)
+        {
+            CycleCounter::WaitPeriod(edge, bitTime);
+            frame |= uint16_t(_RxPin::IsSet()) << i;
+        }
+
+        // Skip to stop bit, so next Read doesn't take last data bit as start bit
+        CycleCounter::WaitPeriod(edge, bitTime);
+
+        return static_cast<uint8_t>(frame & ((1u << (frameBits - _parity)) - 1));
+    }
+
+    SOFT_USART_TEMPLATE_ARGS
+    bool SOFT_USART_TEMPLATE_QUALIFIER::WriteReady()
+    {
+        return true;
+    }
+
+    SOFT_USART_TEMPLATE_ARGS
+    void SOFT_USART_TEMPLATE_QUALIFIER::Write(const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for(size_t i = 0; i < size; ++i)
+            Write(bytes[i]);
+    }
+
+    SOFT_USART_TEMPLATE_ARGS
+    void SOFT_USART_TEMPLATE_QUALIFIER::Write(uint8_t data)
+    {
+        const CycleCounter::Ticks bitTime = _bitTime;
+        const unsigned frameBits = _dataBits;
+        const unsigned dataBits = frameBits - _parity;
+
+        uint16_t frame = data & ((1u << dataBits) - 1);
+        if(_parity)
+            frame |= uint16_t((std::popcount(frame) & 1) ^ _oddParity) << dataBits;
+
+        CycleCounter::Ticks edge = CycleCounter::Now();
+        _TxPin::Clear();
+        for(unsigned i = 0; i < frameBits; ++i)
+        {
+            CycleCounter::WaitPeriod(edge, bitTime);
+            _TxPin::Set((frame >> i) & 1);
+        }
+
+        CycleCounter::WaitPeriod(edge, bitTime);
+        _TxPin::Set();
+        for(unsigned i = 0; i < _stopBits; ++i)
+            CycleCounter::WaitPeriod(edge, bitTime);
+    }
+}
+
+#undef SOFT_USART_TEMPLATE_ARGS
+#undef SOFT_USART_TEMPLATE_QUALIFIER
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_SOFT_USART_H
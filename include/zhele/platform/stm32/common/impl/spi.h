@@ -9,6 +9,9 @@
 #ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_SPI_H
 #define ZHELE_PLATFORM_STM32_COMMON_IMPL_SPI_H
 
+#include <cstring>
+#include <type_traits>
+
 namespace Zhele::Private
 {
     #define SPI_TEMPLATE_ARGS template< \
@@ -26,13 +29,13 @@ namespace Zhele::Private
     SPI_TEMPLATE_ARGS
     void SPI_TEMPLATE_QUALIFIER::Enable()
     {
-        _Regs()->CR1 |= SPI_CR1_SPE;
+        BitBand::Set(_Regs()->CR1, SPI_CR1_SPE_Pos);
     }
 
     SPI_TEMPLATE_ARGS
     void SPI_TEMPLATE_QUALIFIER::Disable()
     {
-        _Regs()->CR1 &= ~SPI_CR1_SPE;
+        BitBand::Clear(_Regs()->CR1, SPI_CR1_SPE_Pos);
     }
 
     SPI_TEMPLATE_ARGS
@@ -86,6 +89,9 @@ namespace Zhele::Private
                 }
             #endif
         #endif
+        _dmaDataSize = dataSize > DataSize8
+            ? (_DmaTx::PSize16Bits | _DmaTx::MSize16Bits)
+            : (_DmaTx::PSize8Bits | _DmaTx::MSize8Bits);
     }
 
     SPI_TEMPLATE_ARGS
@@ -97,13 +103,13 @@ namespace Zhele::Private
     SPI_TEMPLATE_ARGS
     void SPI_TEMPLATE_QUALIFIER::SetSS()
     {
-        _Regs()->CR1 |= SPI_CR1_SSI;
+        BitBand::Set(_Regs()->CR1, SPI_CR1_SSI_Pos);
     }
 
     SPI_TEMPLATE_ARGS
     void SPI_TEMPLATE_QUALIFIER::ClearSS()
     {
-        _Regs()->CR1 &= ~SPI_CR1_SSI;
+        BitBand::Clear(_Regs()->CR1, SPI_CR1_SSI_Pos);
     }
 
     SPI_TEMPLATE_ARGS
@@ -117,11 +123,13 @@ namespace Zhele::Private
     {
         while ((_Regs()->SR & SPI_SR_TXE) == 0);
 
+        // Frame size cannot change during transfer, so check it once
     #if defined(SPI_CR1_DFF)
-        if(_Regs()->CR1 & SPI_CR1_DFF)
+        bool wideFrame = (_Regs()->CR1 & SPI_CR1_DFF) > 0;
     #else
-        if((_Regs()->CR2 & SPI_CR2_DS) > DataSize8)
+        bool wideFrame = (_Regs()->CR2 & SPI_CR2_DS) > DataSize8;
     #endif
+        if(wideFrame)
         {
             _Regs()->DR = value;
         }
@@ -131,11 +139,7 @@ namespace Zhele::Private
         }
         
         while ((_Regs()->SR & SPI_SR_RXNE) == 0);
-    #if defined(SPI_CR1_DFF)
-        if(_Regs()->CR1 & SPI_CR1_DFF)
-    #else
-        if((_Regs()->CR2 & SPI_CR2_DS) > DataSize8)
-    #endif
+        if(wideFrame)
         {
             return _Regs()->DR;
         }
@@ -145,19 +149,71 @@ namespace Zhele::Private
         }
     }
 
+    SPI_TEMPLATE_ARGS
+    template<SpiBase::DataSize _DataSize>
+    void SPI_TEMPLATE_QUALIFIER::Transfer(const void* transmitBuffer, void* receiveBuffer, size_t count)
+    {
+        using Frame = std::conditional_t<(_DataSize > DataSize8), uint16_t, uint8_t>;
+        const uint8_t* transmit = static_cast<const uint8_t*>(transmitBuffer);
+        uint8_t* receive = static_cast<uint8_t*>(receiveBuffer);
+
+    #if defined(SPI_CR2_FRXTH)
+        if constexpr (std::is_same_v<Frame, uint8_t>)
+        {
+            // RXNE is set when FIFO has 16 bits, so two frames are moved by one access
+            _Regs()->CR2 &= ~SPI_CR2_FRXTH;
+            TransferFrames<uint16_t>(transmit, receive, count / 2);
+            _Regs()->CR2 |= SPI_CR2_FRXTH;
+
+            if((count & 1) == 0)
+                return;
+
+            size_t last = count - 1;
+            TransferFrames<uint8_t>(transmit ? transmit + last : nullptr, receive ? receive + last : nullptr, 1);
+            return;
+        }
+    #endif
+        TransferFrames<Frame>(transmit, receive, count);
+    }
+
+    SPI_TEMPLATE_ARGS
+    template<typename _Frame>
+    void SPI_TEMPLATE_QUALIFIER::TransferFrames(const uint8_t* transmitBuffer, uint8_t* receiveBuffer, size_t count)
+    {
+        // Two data register accesses in flight: shift register and TX buffer (or half of TX FIFO).
+        // More would overrun RX buffer (FIFO) before it is read.
+        static constexpr size_t InFlight = 2;
+        __IO _Frame& dataRegister = *(__IO _Frame*)&_Regs()->DR;
+
+        size_t sent = 0;
+        size_t received = 0;
+        while(received < count)
+        {
+            uint32_t status = _Regs()->SR;
+            if((status & SPI_SR_TXE) && sent < count && sent - received < InFlight)
+            {
+                _Frame value = static_cast<_Frame>(0xffff);
+                if(transmitBuffer)
+                    std::memcpy(&value, transmitBuffer + sent * sizeof(_Frame), sizeof(_Frame));
+                dataRegister = value;
+                ++sent;
+            }
+            if(status & SPI_SR_RXNE)
+            {
+                _Frame value = dataRegister;
+                if(receiveBuffer)
+                    std::memcpy(receiveBuffer + received * sizeof(_Frame), &value, sizeof(_Frame));
+                ++received;
+            }
+        }
+    }
+
     SPI_TEMPLATE_ARGS
     void SPI_TEMPLATE_QUALIFIER::SendAsync(void* transmitBuffer, void* receiveBuffer, size_t bufferSize, TransferCallback callback)
     {
         _DmaRx::ClearTransferComplete();
         _Regs()->CR2 |= (SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
-        auto dataSize = 
-        #if defined(SPI_CR1_DFF)
-            (_Regs()->CR1 & SPI_CR1_DFF) > 0
-        #else
-            (_Regs()->CR2 & SPI_CR2_DS) > DataSize8
-        #endif
-            ? (_DmaTx::PSize16Bits | _DmaTx::MSize16Bits)
-            : (_DmaTx::PSize8Bits | _DmaTx::MSize8Bits);
+        auto dataSize = _dmaDataSize;
         _DmaRx::SetTransferCallback(callback);
         _DmaRx::Transfer(_DmaRx::Periph2Mem | _DmaRx::MemIncrement | _DmaRx::Circular | dataSize, receiveBuffer, &_Regs()->DR, bufferSize);
 
@@ -174,33 +230,30 @@ namespace Zhele::Private
     void SPI_TEMPLATE_QUALIFIER::WriteAsync(const void* data, uint16_t size, TransferCallback callback)
     {
         _DmaTx::ClearTransferComplete();
-        _Regs()->CR2 |= SPI_CR2_TXDMAEN;
-        typename _DmaTx::Mode dataSize = 
-        #if defined(SPI_CR1_DFF)
-            (_Regs()->CR1 & SPI_CR1_DFF) > 0
-        #else
-            (_Regs()->CR2 & SPI_CR2_DS) > DataSize8
-        #endif
-            ? (_DmaTx::PSize16Bits | _DmaTx::MSize16Bits)
-            : (_DmaTx::PSize8Bits | _DmaTx::MSize8Bits);
+        BitBand::Set(_Regs()->CR2, SPI_CR2_TXDMAEN_Pos);
+        auto dataSize = _dmaDataSize;
 
         _DmaTx::SetTransferCallback(callback);
         _DmaTx::Transfer(_DmaTx::Mem2Periph | _DmaTx::MemIncrement | dataSize, data, &_Regs()->DR, size);
     }
 
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::WriteAsyncList(const DmaDescriptor* descriptors, uint16_t count, TransferCallback callback)
+    {
+        _DmaTx::ClearTransferComplete();
+        BitBand::Set(_Regs()->CR2, SPI_CR2_TXDMAEN_Pos);
+        auto dataSize = _dmaDataSize;
+
+        _DmaTx::SetTransferCallback(callback);
+        _DmaTx::TransferList(_DmaTx::Mem2Periph | _DmaTx::MemIncrement | dataSize, descriptors, count, &_Regs()->DR);
+    }
+
     SPI_TEMPLATE_ARGS
     void SPI_TEMPLATE_QUALIFIER::WriteAsyncNoIncrement(const void* data, uint16_t size, TransferCallback callback)
     {
         _DmaTx::ClearTransferComplete();
-        _Regs()->CR2 |= SPI_CR2_TXDMAEN;
-        auto dataSize = 
-        #if defined(SPI_CR1_DFF)
-            (_Regs()->CR1 & SPI_CR1_DFF) > 0
-        #else
-            (_Regs()->CR2 & SPI_CR2_DS) > DataSize8
-        #endif
-            ? (_DmaTx::PSize16Bits | _DmaTx::MSize16Bits)
-            : (_DmaTx::PSize8Bits | _DmaTx::MSize8Bits);
+        BitBand::Set(_Regs()->CR2, SPI_CR2_TXDMAEN_Pos);
+        auto dataSize = _dmaDataSize;
 
         _DmaTx::SetTransferCallback(callback);
         _DmaTx::Transfer(_DmaTx::Mem2Periph | dataSize, data, &_Regs()->DR, size);
@@ -217,14 +270,7 @@ namespace Zhele::Private
     {
         _DmaRx::ClearTransferComplete();
         _Regs()->CR2 |= (SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
-        auto dataSize = 
-        #if defined(SPI_CR1_DFF)
-            (_Regs()->CR1 & SPI_CR1_DFF) > 0
-        #else
-            (_Regs()->CR2 & SPI_CR2_DS) > DataSize8
-        #endif
-            ? (_DmaTx::PSize16Bits | _DmaTx::MSize16Bits)
-            : (_DmaTx::PSize8Bits | _DmaTx::MSize8Bits);
+        auto dataSize = _dmaDataSize;
         _DmaRx::SetTransferCallback(callback);
         _DmaRx::Transfer(_DmaRx::Periph2Mem | _DmaRx::MemIncrement | _DmaRx::Circular | dataSize, receiveBuffer, &_Regs()->DR, bufferSize);
 
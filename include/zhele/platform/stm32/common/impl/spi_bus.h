@@ -0,0 +1,166 @@
+/**
+ * @file
+ * SPI bus transaction queue methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_SPI_BUS_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_SPI_BUS_H
+
+namespace Zhele
+{
+    #define SPI_BUS_TEMPLATE_ARGS template<typename _Spi, unsigned _QueueSize>
+    #define SPI_BUS_TEMPLATE_QUALIFIER SpiBus<_Spi, _QueueSize>
+
+    SPI_BUS_TEMPLATE_ARGS
+    bool SPI_BUS_TEMPLATE_QUALIFIER::Enqueue(const Transaction& transaction)
+    {
+        if(!_queue.push_back(transaction))
+            return false;
+
+        if(!_busy)
+            StartNext();
+
+        return true;
+    }
+
+    SPI_BUS_TEMPLATE_ARGS
+    size_t SPI_BUS_TEMPLATE_QUALIFIER::Pending()
+    {
+        return _queue.size();
+    }
+
+    SPI_BUS_TEMPLATE_ARGS
+    bool SPI_BUS_TEMPLATE_QUALIFIER::Idle()
+    {
+        return !_busy && _queue.empty();
+    }
+
+    SPI_BUS_TEMPLATE_ARGS
+    void SPI_BUS_TEMPLATE_QUALIFIER::Flush()
+    {
+        while(!Idle())
+            continue;
+    }
+
+    SPI_BUS_TEMPLATE_ARGS
+    void SPI_BUS_TEMPLATE_QUALIFIER::StartNext()
+    {
+        // Called by producer only when bus is idle (so there is no concurrent TransferCompleted)
+        // and from TransferCompleted
+        while(!_queue.empty())
+        {
+            _busy = true;
+            const Transaction& transaction = _queue.front();
+
+            // Device kept selected by previous transaction must not see clock reconfiguration
+            if(_selected != nullptr && _selected != transaction.Select)
+            {
+                _selected(false);
+                _selected = nullptr;
+            }
+
+            Configure(transaction);
+
+            if(_selected == nullptr)
+            {
+                transaction.Select(true);
+                _selected = transaction.Select;
+            }
+
+            if(transaction.Count != 0)
+            {
+                StartTransfer(transaction);
+                return;
+            }
+
+            // Empty transaction only changes chip select
+            Complete(true);
+        }
+
+        _busy = false;
+    }
+
+    SPI_BUS_TEMPLATE_ARGS
+    void SPI_BUS_TEMPLATE_QUALIFIER::Configure(const Transaction& transaction)
+    {
+        Configuration configuration {transaction.Divider, transaction.Polarity, transaction.Phase, transaction.DataSize};
+        if(_configured && configuration == _configuration)
+            return;
+
+        // Clock and frame settings must not be changed while SPI is enabled
+        while(_Spi::Busy())
+            continue;
+        _Spi::Disable();
+        _Spi::SetDivider(configuration.Divider);
+        _Spi::SetClockPolarity(configuration.Polarity);
+        _Spi::SetClockPhase(configuration.Phase);
+        _Spi::SetDataSize(configuration.DataSize);
+        _Spi::Enable();
+
+        _configuration = configuration;
+        _configured = true;
+    }
+
+    SPI_BUS_TEMPLATE_ARGS
+    void SPI_BUS_TEMPLATE_QUALIFIER::StartTransfer(const Transaction& transaction)
+    {
+        auto dataSize = transaction.DataSize > Transaction::SpiBase::DataSize8
+            ? (DmaTx::PSize16Bits | DmaTx::MSize16Bits)
+            : (DmaTx::PSize8Bits | DmaTx::MSize8Bits);
+
+        auto receiveMode = DmaRx::Periph2Mem | dataSize;
+        void* receiveBuffer = &_sink;
+        if(transaction.ReceiveBuffer != nullptr)
+        {
+            receiveMode = receiveMode | DmaRx::MemIncrement;
+            receiveBuffer = transaction.ReceiveBuffer;
+        }
+
+        auto transmitMode = DmaTx::Mem2Periph | dataSize;
+        const void* transmitBuffer = &_dummy;
+        if(transaction.TransmitBuffer != nullptr)
+        {
+            transmitMode = transmitMode | DmaTx::MemIncrement;
+            transmitBuffer = transaction.TransmitBuffer;
+        }
+
+        // Transaction is completed by RX DMA: last frame is received when it is shifted out
+        Regs()->CR2 |= (SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+        DmaRx::ClearFlags();
+        DmaRx::SetTransferCallback(TransferCompleted);
+        DmaRx::Transfer(receiveMode, receiveBuffer, &Regs()->DR, transaction.Count);
+
+        DmaTx::ClearFlags();
+        DmaTx::SetTransferCallback(nullptr);
+        DmaTx::Transfer(transmitMode, transmitBuffer, &Regs()->DR, transaction.Count);
+    }
+
+    SPI_BUS_TEMPLATE_ARGS
+    void SPI_BUS_TEMPLATE_QUALIFIER::Complete(bool success)
+    {
+        Transaction transaction = _queue.front();
+        _queue.pop_front();
+
+        if(!transaction.KeepSelected)
+        {
+            transaction.Select(false);
+            _selected = nullptr;
+        }
+
+        if(transaction.OnComplete)
+            transaction.OnComplete(success);
+    }
+
+    SPI_BUS_TEMPLATE_ARGS
+    void SPI_BUS_TEMPLATE_QUALIFIER::TransferCompleted(void*, unsigned, bool success)
+    {
+        Complete(success);
+        StartNext();
+    }
+} // namespace Zhele
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_SPI_BUS_H
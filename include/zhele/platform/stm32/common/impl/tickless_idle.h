@@ -0,0 +1,118 @@
+/**
+ * @file
+ * Tickless idle methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_TICKLESS_IDLE_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_TICKLESS_IDLE_H
+
+namespace Zhele::Timers
+{
+    template<typename _Wheel>
+    void TicklessIdle<_Wheel>::EnableStop()
+    {
+        _stopEnabled = true;
+    }
+
+    template<typename _Wheel>
+    void TicklessIdle<_Wheel>::DisableStop()
+    {
+        _stopEnabled = false;
+    }
+
+    template<typename _Wheel>
+    typename TicklessIdle<_Wheel>::Mode TicklessIdle<_Wheel>::Enter(WorkPending workPending)
+    {
+        uint32_t primask = DisableInterrupts();
+
+        Ticks delay = _Wheel::NextExpiryDelay();
+        if((workPending && workPending()) || delay == 0)
+        {
+            RestoreInterrupts(primask);
+            return Mode::Busy;
+        }
+
+        Mode mode = Mode::Sleep;
+        if(_stopEnabled && delay == std::numeric_limits<Ticks>::max())
+        {
+            mode = Mode::Stop;
+            EnterStop();
+        }
+        else
+        {
+            WaitForInterrupt();
+        }
+
+        RestoreInterrupts(primask);
+        return mode;
+    }
+
+    template<typename _Wheel>
+    void TicklessIdle<_Wheel>::EnterStop()
+    {
+        uint32_t source = Private::RccRegs()->CFGR & RCC_CFGR_SWS;
+
+        Clock::PowerClock::Enable();
+    #if defined(PWR_CR_LPDS)
+        // Stop (not Standby) with low-power regulator
+        Private::PwrRegs()->CR = (Private::PwrRegs()->CR & ~PWR_CR_PDDS) | PWR_CR_LPDS;
+    #else
+        // Stop 0
+        Private::PwrRegs()->CR1 &= ~PWR_CR1_LPMS;
+    #endif
+        Private::ScbRegs()->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+        WaitForInterrupt();
+        Private::ScbRegs()->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+        // Core wakes up on HSI (MSI on L4), select source that was used before
+        if((Private::RccRegs()->CFGR & RCC_CFGR_SWS) == source)
+            return;
+        if(source == RCC_CFGR_SWS_HSE)
+            Clock::SysClock::SelectClockSource<Clock::SysClock::External>();
+    #if defined(RCC_CFGR_SWS_PLL)
+        else if(source == RCC_CFGR_SWS_PLL)
+            Clock::SysClock::SelectClockSource<Clock::SysClock::Pll>();
+    #endif
+        else if(source == RCC_CFGR_SWS_HSI)
+            Clock::SysClock::SelectClockSource<Clock::SysClock::Internal>();
+    }
+
+    template<typename _Wheel>
+    void TicklessIdle<_Wheel>::WaitForInterrupt()
+    {
+    #if defined(ZHELE_HOST_REGISTERS)
+        Host::RegisterFile::WaitForInterrupt();
+    #else
+        __DSB();
+        __WFI();
+    #endif
+    }
+
+    template<typename _Wheel>
+    uint32_t TicklessIdle<_Wheel>::DisableInterrupts()
+    {
+    #if defined(ZHELE_HOST_REGISTERS)
+        return 0;
+    #else
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        return primask;
+    #endif
+    }
+
+    template<typename _Wheel>
+    void TicklessIdle<_Wheel>::RestoreInterrupts(uint32_t primask)
+    {
+    #if defined(ZHELE_HOST_REGISTERS)
+        static_cast<void>(primask);
+    #else
+        __set_PRIMASK(primask);
+    #endif
+    }
+}
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_TICKLESS_IDLE_H
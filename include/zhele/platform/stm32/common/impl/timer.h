@@ -184,6 +184,49 @@ namespace Zhele::Timers::Private
         _Regs()->SMCR = (_Regs()->SMCR & ~TIM_SMCR_ETPS_Msk) | static_cast<uint16_t>(prescaler);
     }
 
+    GPTIMER_TEMPLATE_ARGS
+    template<typename _DmaChannel>
+    template<typename _Data>
+    bool GPTIMER_TEMPLATE_QUALIFIER::DmaBurst<_DmaChannel>::Start(BurstRegister base, uint8_t length, const _Data* table, uint16_t bursts, bool circular
+    ONLY_IF_STREAM_SUPPORTED(COMMA uint8_t channel))
+    {
+        static_assert(sizeof(_Data) == 2 || sizeof(_Data) == 4, "Burst table items should be 16 or 32 bits");
+        using Mode = typename _DmaChannel::Mode;
+
+        // Whole table is one DMA transfer, NDTR is 16-bit
+        uint32_t items = uint32_t(length) * bursts;
+        if(length == 0 || length > 18 || items > 0xffff)
+            return false;
+
+        Mode mode = _DmaChannel::Mem2Periph | _DmaChannel::MemIncrement
+            | (sizeof(_Data) == 4
+                ? (_DmaChannel::MSize32Bits | _DmaChannel::PSize32Bits)
+                : (_DmaChannel::MSize16Bits | _DmaChannel::PSize16Bits));
+        if(circular)
+            mode = mode | _DmaChannel::Circular;
+
+        _Regs()->DIER &= ~TIM_DIER_UDE;
+        _Regs()->DCR = ((length - 1u) << TIM_DCR_DBL_Pos) | (static_cast<uint32_t>(base) << TIM_DCR_DBA_Pos);
+        _DmaChannel::Transfer(mode, table, &_Regs()->DMAR, items ONLY_IF_STREAM_SUPPORTED(COMMA channel));
+        _Regs()->DIER |= TIM_DIER_UDE;
+        return true;
+    }
+
+    GPTIMER_TEMPLATE_ARGS
+    template<typename _DmaChannel>
+    void GPTIMER_TEMPLATE_QUALIFIER::DmaBurst<_DmaChannel>::Stop()
+    {
+        _Regs()->DIER &= ~TIM_DIER_UDE;
+        _DmaChannel::Disable();
+    }
+
+    GPTIMER_TEMPLATE_ARGS
+    template<typename _DmaChannel>
+    bool GPTIMER_TEMPLATE_QUALIFIER::DmaBurst<_DmaChannel>::Done()
+    {
+        return _DmaChannel::RemainingTransfers() == 0;
+    }
+
     GPTIMER_TEMPLATE_ARGS
     template<unsigned _ChannelNumber>
     void GPTIMER_TEMPLATE_QUALIFIER::ChannelBase<_ChannelNumber>::EnableInterrupt()
@@ -262,6 +305,44 @@ namespace Zhele::Timers::Private
         return (&_Regs()->CCR1)[_ChannelNumber];
     }
 
+    GPTIMER_TEMPLATE_ARGS
+    template<unsigned _ChannelNumber>
+    template<typename _DmaChannel>
+    void GPTIMER_TEMPLATE_QUALIFIER::InputCapture<_ChannelNumber>::DmaCapture<_DmaChannel>::Start(typename Base::Counter* buffer, uint16_t size
+    ONLY_IF_STREAM_SUPPORTED(COMMA uint8_t channel))
+    {
+        using Mode = typename _DmaChannel::Mode;
+
+        Mode mode = _DmaChannel::Periph2Mem | _DmaChannel::MemIncrement | _DmaChannel::Circular
+            | (sizeof(typename Base::Counter) == 4
+                ? (_DmaChannel::MSize32Bits | _DmaChannel::PSize32Bits)
+                : (_DmaChannel::MSize16Bits | _DmaChannel::PSize16Bits));
+
+        _size = size;
+        Channel::DisableDmaRequest();
+        _DmaChannel::Transfer(mode, buffer, &(&_Regs()->CCR1)[_ChannelNumber], size ONLY_IF_STREAM_SUPPORTED(COMMA channel));
+        Channel::EnableDmaRequest();
+    }
+
+    GPTIMER_TEMPLATE_ARGS
+    template<unsigned _ChannelNumber>
+    template<typename _DmaChannel>
+    void GPTIMER_TEMPLATE_QUALIFIER::InputCapture<_ChannelNumber>::DmaCapture<_DmaChannel>::Stop()
+    {
+        Channel::DisableDmaRequest();
+        _DmaChannel::Disable();
+    }
+
+    GPTIMER_TEMPLATE_ARGS
+    template<unsigned _ChannelNumber>
+    template<typename _DmaChannel>
+    uint16_t GPTIMER_TEMPLATE_QUALIFIER::InputCapture<_ChannelNumber>::DmaCapture<_DmaChannel>::Position()
+    {
+        // Counter is reloaded in circular mode, so it is zero only for an instant
+        uint16_t position = _size - _DmaChannel::RemainingTransfers();
+        return position < _size ? position : 0;
+    }
+
     GPTIMER_TEMPLATE_ARGS
     template<unsigned _ChannelNumber>
     void GPTIMER_TEMPLATE_QUALIFIER::OutputCompare<_ChannelNumber>::SetPulse(typename Base::Counter pulse)
@@ -0,0 +1,282 @@
+/**
+ * @file
+ * Timer wheel methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_TIMER_WHEEL_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_TIMER_WHEEL_H
+
+#include <algorithm>
+#include <bit>
+
+namespace Zhele::Timers
+{
+    #define TIMER_WHEEL_TEMPLATE_ARGS template<typename _Timer, unsigned _Channel, unsigned _SlotBits, unsigned _Levels>
+    #define TIMER_WHEEL_TEMPLATE_QUALIFIER TimerWheel<_Timer, _Channel, _SlotBits, _Levels>
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    void TIMER_WHEEL_TEMPLATE_QUALIFIER::Init(unsigned tickFrequency)
+    {
+        _Timer::Enable();
+        _Timer::SetPrescaler(_Timer::GetClockFreq() / tickFrequency - 1);
+        // Update event loads prescaler
+        _Timer::SetPeriodAndUpdate(std::numeric_limits<Counter>::max());
+        _Timer::Start();
+
+        _now = 0;
+        _counter = _Timer::GetCounterValue();
+        Compare::ClearInterruptFlag();
+        Schedule(std::numeric_limits<Ticks>::max());
+        Compare::EnableInterrupt();
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    typename TIMER_WHEEL_TEMPLATE_QUALIFIER::Ticks TIMER_WHEEL_TEMPLATE_QUALIFIER::Now()
+    {
+        Lock();
+        Ticks now = _now + CounterElapsed(_Timer::GetCounterValue());
+        Unlock();
+        return now;
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    void TIMER_WHEEL_TEMPLATE_QUALIFIER::Start(SoftTimer& timer, Ticks delay, Ticks period)
+    {
+        Lock();
+        if(timer.IsActive())
+            Remove(timer);
+        timer._expiry = _now + CounterElapsed(_Timer::GetCounterValue()) + std::min(delay, MaxDelay);
+        timer._period = std::min(period, MaxDelay);
+        Insert(timer);
+        // Handler programs compare itself after callbacks
+        Ticks distance = timer._expiry - _now;
+        if(!_inHandler && distance < _wakeup - _now)
+            Schedule(distance);
+        Unlock();
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    void TIMER_WHEEL_TEMPLATE_QUALIFIER::Cancel(SoftTimer& timer)
+    {
+        // Compare is not reprogrammed: interrupt of removed event finds nothing to do
+        Lock();
+        if(timer.IsActive())
+            Remove(timer);
+        Unlock();
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    typename TIMER_WHEEL_TEMPLATE_QUALIFIER::Ticks TIMER_WHEEL_TEMPLATE_QUALIFIER::NextExpiryDelay()
+    {
+        Lock();
+        Ticks distance = NextExpiry();
+        Ticks elapsed = CounterElapsed(_Timer::GetCounterValue());
+        Unlock();
+
+        if(distance == std::numeric_limits<Ticks>::max())
+            return distance;
+        return distance > elapsed ? distance - elapsed : 0;
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    void TIMER_WHEEL_TEMPLATE_QUALIFIER::IRQHandler()
+    {
+        Compare::ClearInterruptFlag();
+
+        _inHandler = true;
+        Counter counter = _Timer::GetCounterValue();
+        Ticks to = _now + CounterElapsed(counter);
+        _counter = counter;
+        Advance(to);
+        Schedule(NextExpiry());
+        _inHandler = false;
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    typename TIMER_WHEEL_TEMPLATE_QUALIFIER::Ticks TIMER_WHEEL_TEMPLATE_QUALIFIER::CounterElapsed(Counter counter)
+    {
+        return static_cast<Counter>(counter - _counter);
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    unsigned TIMER_WHEEL_TEMPLATE_QUALIFIER::NextSlot(unsigned level)
+    {
+        SlotMask occupied = _occupied[level];
+        unsigned current = (_now >> (level * _SlotBits)) & (SlotsCount - 1);
+        SlotMask rotated = current == 0
+            ? occupied
+            : ((occupied >> current) | (occupied << (SlotsCount - current))) & AllSlots;
+        return std::countr_zero(rotated);
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    typename TIMER_WHEEL_TEMPLATE_QUALIFIER::Ticks TIMER_WHEEL_TEMPLATE_QUALIFIER::NextEvent(unsigned& level)
+    {
+        Ticks nearest = std::numeric_limits<Ticks>::max();
+
+        // Coarse levels first: cascade must be done before expiration at the same time
+        for(unsigned i = _Levels; i-- > 0;)
+        {
+            if(_occupied[i] == 0)
+                continue;
+
+            unsigned shift = i * _SlotBits;
+            Ticks distance = (((_now >> shift) + NextSlot(i)) << shift) - _now;
+            if(distance < nearest)
+            {
+                nearest = distance;
+                level = i;
+            }
+        }
+        return nearest;
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    typename TIMER_WHEEL_TEMPLATE_QUALIFIER::Ticks TIMER_WHEEL_TEMPLATE_QUALIFIER::NextExpiry()
+    {
+        Ticks nearest = std::numeric_limits<Ticks>::max();
+        if(_occupied[0] != 0)
+            nearest = NextSlot(0);
+
+        // Timers of first occupied coarse slot expire before timers of next slots of the same level,
+        // slot is not scanned if it starts after nearest expiration found on finer levels
+        for(unsigned i = 1; i < _Levels; ++i)
+        {
+            if(_occupied[i] == 0)
+                continue;
+
+            unsigned shift = i * _SlotBits;
+            Ticks slot = (_now >> shift) + NextSlot(i);
+            if((slot << shift) - _now >= nearest)
+                continue;
+            for(SoftTimer* timer = _slots[i * SlotsCount + (slot & (SlotsCount - 1))]; timer != nullptr; timer = timer->_next)
+                nearest = std::min(nearest, timer->_expiry - _now);
+        }
+        return nearest;
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    void TIMER_WHEEL_TEMPLATE_QUALIFIER::Insert(SoftTimer& timer)
+    {
+        // Finest level which slot differs from current time only in this level digit
+        unsigned level = 0;
+        while(level + 1 < _Levels && ((timer._expiry ^ _now) >> ((level + 1) * _SlotBits)) != 0)
+            ++level;
+
+        unsigned slot = (timer._expiry >> (level * _SlotBits)) & (SlotsCount - 1);
+        SoftTimer*& head = _slots[level * SlotsCount + slot];
+
+        timer._slot = level * SlotsCount + slot;
+        timer._next = head;
+        if(head != nullptr)
+            head->_pprev = &timer._next;
+        timer._pprev = &head;
+        head = &timer;
+        _occupied[level] |= SlotMask(1) << slot;
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    void TIMER_WHEEL_TEMPLATE_QUALIFIER::Remove(SoftTimer& timer)
+    {
+        *timer._pprev = timer._next;
+        if(timer._next != nullptr)
+            timer._next->_pprev = timer._pprev;
+        timer._next = nullptr;
+        timer._pprev = nullptr;
+
+        if(_slots[timer._slot] == nullptr)
+            _occupied[timer._slot / SlotsCount] &= ~(SlotMask(1) << (timer._slot % SlotsCount));
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    void TIMER_WHEEL_TEMPLATE_QUALIFIER::Advance(Ticks to)
+    {
+        Ticks remaining = to - _now;
+        for(;;)
+        {
+            unsigned level;
+            Ticks distance = NextEvent(level);
+            if(distance > remaining)
+                break;
+
+            _now += distance;
+            remaining -= distance;
+
+            // Slot list is moved to local head, so callbacks can cancel timers of this slot
+            unsigned slot = level * SlotsCount + ((_now >> (level * _SlotBits)) & (SlotsCount - 1));
+            SoftTimer* pending = _slots[slot];
+            _slots[slot] = nullptr;
+            _occupied[level] &= ~(SlotMask(1) << (slot % SlotsCount));
+            pending->_pprev = &pending;
+
+            while(pending != nullptr)
+            {
+                SoftTimer& timer = *pending;
+                Remove(timer);
+                if(level == 0)
+                    Expire(timer, to);
+                else
+                    Insert(timer);
+            }
+        }
+        _now = to;
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    void TIMER_WHEEL_TEMPLATE_QUALIFIER::Expire(SoftTimer& timer, Ticks now)
+    {
+        // Periodic timer is rescheduled before callback, so callback can cancel it
+        if(timer._period != 0)
+        {
+            timer._expiry += timer._period;
+            // Interrupt is late more than period: resynchronize instead of bursting missed expirations
+            if(static_cast<int32_t>(timer._expiry - now) < 0)
+                timer._expiry = now + timer._period;
+            Insert(timer);
+        }
+        if(timer._callback)
+            timer._callback();
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    void TIMER_WHEEL_TEMPLATE_QUALIFIER::Schedule(Ticks distance)
+    {
+        for(;;)
+        {
+            Counter counter = _Timer::GetCounterValue();
+            Ticks elapsed = CounterElapsed(counter);
+            // Compare is armed at least each half of counter period to keep wheel time
+            Ticks delay = std::min(distance > elapsed ? distance - elapsed : 1, MaxCompareDelay);
+            Compare::SetPulse(static_cast<Counter>(counter + delay));
+            // Counter has passed compare value while it was written: arm again
+            if(static_cast<Counter>(_Timer::GetCounterValue() - counter) < delay)
+            {
+                _wakeup = _now + elapsed + delay;
+                return;
+            }
+        }
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    void TIMER_WHEEL_TEMPLATE_QUALIFIER::Lock()
+    {
+        if(!_inHandler)
+            Compare::DisableInterrupt();
+    }
+
+    TIMER_WHEEL_TEMPLATE_ARGS
+    void TIMER_WHEEL_TEMPLATE_QUALIFIER::Unlock()
+    {
+        if(!_inHandler)
+            Compare::EnableInterrupt();
+    }
+
+    #undef TIMER_WHEEL_TEMPLATE_ARGS
+    #undef TIMER_WHEEL_TEMPLATE_QUALIFIER
+}
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_TIMER_WHEEL_H
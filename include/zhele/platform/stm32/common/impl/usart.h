@@ -75,11 +75,20 @@ namespace Zhele
         void USART_TEMPLATE_QUALIFIER::EnableAsyncRead(void* receiveBuffer, size_t bufferSize, TransferCallback callback)
         {
             _DmaRx::ClearTransferComplete();
-            _Regs()->CR3 |= USART_CR3_DMAR;
+            BitBand::Set(_Regs()->CR3, USART_CR3_DMAR_Pos);
             _DmaRx::SetTransferCallback(callback);
             _DmaRx::Transfer(_DmaRx::Periph2Mem | _DmaRx::MemIncrement, receiveBuffer, &_Regs()->RECEIVE_DATA_REG, bufferSize);
         }
 
+        USART_TEMPLATE_ARGS
+        void USART_TEMPLATE_QUALIFIER::EnableAsyncReadList(const DmaReceiveDescriptor* descriptors, uint16_t count, TransferCallback callback)
+        {
+            _DmaRx::ClearTransferComplete();
+            BitBand::Set(_Regs()->CR3, USART_CR3_DMAR_Pos);
+            _DmaRx::SetTransferCallback(callback);
+            _DmaRx::TransferList(_DmaRx::Periph2Mem | _DmaRx::MemIncrement, descriptors, count, &_Regs()->RECEIVE_DATA_REG);
+        }
+
         USART_TEMPLATE_ARGS
         bool USART_TEMPLATE_QUALIFIER::WriteReady()
         {
@@ -120,7 +129,7 @@ namespace Zhele
             while (!WriteReady()) ;
             _DmaTx::ClearTransferComplete();
             _DmaTx::SetTransferCallback(callback);
-            _Regs()->CR3 |= USART_CR3_DMAT;
+            BitBand::Set(_Regs()->CR3, USART_CR3_DMAT_Pos);
         #if defined (USART_TYPE_1)
             _Regs()->ICR = TxCompleteInt;
         #endif
@@ -130,6 +139,25 @@ namespace Zhele
             _DmaTx::Transfer(_DmaTx::Mem2Periph | _DmaTx::MemIncrement, data, &_Regs()->TRANSMIT_DATA_REG, size);
         }
 
+        USART_TEMPLATE_ARGS
+        void USART_TEMPLATE_QUALIFIER::WriteAsyncList(const DmaDescriptor* descriptors, uint16_t count, TransferCallback callback)
+        {
+            if (count == 0)
+                return;
+
+            while (!WriteReady()) ;
+            _DmaTx::ClearTransferComplete();
+            _DmaTx::SetTransferCallback(callback);
+            BitBand::Set(_Regs()->CR3, USART_CR3_DMAT_Pos);
+        #if defined (USART_TYPE_1)
+            _Regs()->ICR = TxCompleteInt;
+        #endif
+        #if defined (USART_TYPE_2)
+            _Regs()->SR &= ~TxCompleteInt;
+        #endif
+            _DmaTx::TransferList(_DmaTx::Mem2Periph | _DmaTx::MemIncrement, descriptors, count, &_Regs()->TRANSMIT_DATA_REG);
+        }
+
         USART_TEMPLATE_ARGS
         void USART_TEMPLATE_QUALIFIER::Write(uint8_t data)
         {
@@ -0,0 +1,258 @@
+/**
+ * @file
+ * USART receive stream and transmit queue methods implementation
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_IMPL_USART_STREAM_H
+#define ZHELE_PLATFORM_STM32_COMMON_IMPL_USART_STREAM_H
+
+#include <algorithm>
+#include <cstring>
+
+namespace Zhele
+{
+    #define USART_STREAM_TEMPLATE_ARGS template<typename _Usart, unsigned _Size>
+    #define USART_STREAM_TEMPLATE_QUALIFIER UsartRxStream<_Usart, _Size>
+
+    USART_STREAM_TEMPLATE_ARGS
+    void USART_STREAM_TEMPLATE_QUALIFIER::Start(DataCallback callback, [[maybe_unused]] uint32_t receiverTimeout)
+    {
+        _callback = callback;
+        _position = 0;
+        _published = 0;
+        _consumed = 0;
+        _readOffset = 0;
+        _overrun = false;
+
+        DmaRx::SetTransferCallback(nullptr);
+        DmaRx::ClearFlags();
+        _Usart::Regs::Get()->CR3 |= USART_CR3_DMAR;
+        DmaRx::Transfer(DmaRx::Periph2Mem | DmaRx::MemIncrement | DmaRx::Circular
+            | DmaRx::HalfTransferInterrupt | DmaRx::TransferCompleteInterrupt,
+            _buffer, &_Usart::Regs::Get()->RECEIVE_DATA_REG, _Size);
+
+        _Usart::ClearInterruptFlag(_Usart::IdleInt);
+    #if defined (USART_CR2_RTOEN)
+        if(receiverTimeout != 0)
+        {
+            _Usart::EnableReceiverTimeout(receiverTimeout);
+            _Usart::EnableInterrupt(static_cast<typename _Usart::InterruptFlags>(_Usart::IdleInt | _Usart::ReceiveTimeout));
+            return;
+        }
+    #endif
+        _Usart::EnableInterrupt(_Usart::IdleInt);
+    }
+
+    USART_STREAM_TEMPLATE_ARGS
+    void USART_STREAM_TEMPLATE_QUALIFIER::Stop()
+    {
+    #if defined (USART_CR2_RTOEN)
+        _Usart::DisableInterrupt(static_cast<typename _Usart::InterruptFlags>(_Usart::IdleInt | _Usart::ReceiveTimeout));
+    #else
+        _Usart::DisableInterrupt(_Usart::IdleInt);
+    #endif
+        DmaRx::Disable();
+        DmaRx::ClearFlags();
+        _Usart::Regs::Get()->CR3 &= ~USART_CR3_DMAR;
+    }
+
+    USART_STREAM_TEMPLATE_ARGS
+    size_t USART_STREAM_TEMPLATE_QUALIFIER::Available()
+    {
+        uint32_t published = _published;
+        uint32_t available = published - _consumed;
+        if(available > _Size)
+        {
+            // DMA has overwritten data that was not read
+            _overrun = true;
+            Consume(available);
+            return 0;
+        }
+        return available;
+    }
+
+    USART_STREAM_TEMPLATE_ARGS
+    size_t USART_STREAM_TEMPLATE_QUALIFIER::Read(void* data, size_t size)
+    {
+        uint8_t* destination = static_cast<uint8_t*>(data);
+        size_t count = std::min(size, Available());
+
+        size_t offset = _readOffset;
+        size_t first = std::min<size_t>(count, _Size - offset);
+        std::memcpy(destination, &_buffer[offset], first);
+        std::memcpy(destination + first, &_buffer[0], count - first);
+
+        Consume(count);
+        return count;
+    }
+
+    USART_STREAM_TEMPLATE_ARGS
+    std::span<const uint8_t> USART_STREAM_TEMPLATE_QUALIFIER::ReadRegion()
+    {
+        size_t available = Available();
+        size_t offset = _readOffset;
+
+        return {&_buffer[offset], std::min<size_t>(available, _Size - offset)};
+    }
+
+    USART_STREAM_TEMPLATE_ARGS
+    void USART_STREAM_TEMPLATE_QUALIFIER::Consume(size_t count)
+    {
+        _consumed = _consumed + count;
+        _readOffset = (_readOffset + count) % _Size;
+    }
+
+    USART_STREAM_TEMPLATE_ARGS
+    bool USART_STREAM_TEMPLATE_QUALIFIER::Overrun()
+    {
+        Available();
+
+        bool overrun = _overrun;
+        _overrun = false;
+        return overrun;
+    }
+
+    USART_STREAM_TEMPLATE_ARGS
+    void USART_STREAM_TEMPLATE_QUALIFIER::Publish()
+    {
+        // Counter is reloaded in circular mode, so zero means buffer end (same as start)
+        uint32_t position = _Size - DmaRx::RemainingTransfers();
+        if(position >= _Size)
+            position = 0;
+
+        uint32_t received = position >= _position
+            ? position - _position
+            : _Size - _position + position;
+        _position = position;
+
+        if(received == 0)
+            return;
+
+        _published = _published + received;
+
+        if(_callback)
+            _callback(_published - _consumed);
+    }
+
+    USART_STREAM_TEMPLATE_ARGS
+    void USART_STREAM_TEMPLATE_QUALIFIER::DmaIrqHandler()
+    {
+        if(DmaRx::HalfTransfer() || DmaRx::TransferComplete() || DmaRx::TransferError())
+        {
+            DmaRx::ClearFlags();
+            Publish();
+        }
+    }
+
+    USART_STREAM_TEMPLATE_ARGS
+    void USART_STREAM_TEMPLATE_QUALIFIER::UsartIrqHandler()
+    {
+        auto source = _Usart::InterruptSource();
+
+        if(source & _Usart::IdleInt)
+        {
+        #if defined (USART_TYPE_1)
+            _Usart::ClearInterruptFlag(_Usart::IdleInt);
+        #endif
+        #if defined (USART_TYPE_2)
+            // IDLE is cleared by status register read (InterruptSource) followed by data register read
+            static_cast<void>(_Usart::Regs::Get()->RECEIVE_DATA_REG);
+        #endif
+            Publish();
+        }
+    #if defined (USART_CR2_RTOEN)
+        if(source & _Usart::ReceiveTimeout)
+        {
+            _Usart::ClearInterruptFlag(_Usart::ReceiveTimeout);
+            Publish();
+        }
+    #endif
+    }
+
+    #define USART_TX_QUEUE_TEMPLATE_ARGS template<typename _Usart, unsigned _Size>
+    #define USART_TX_QUEUE_TEMPLATE_QUALIFIER UsartTxQueue<_Usart, _Size>
+
+    USART_TX_QUEUE_TEMPLATE_ARGS
+    size_t USART_TX_QUEUE_TEMPLATE_QUALIFIER::Write(const void* data, size_t size)
+    {
+        size_t queued = _queue.push({static_cast<const uint8_t*>(data), size});
+        _rejected += size - queued;
+
+        if(!_busy)
+            StartNext();
+
+        return queued;
+    }
+
+    USART_TX_QUEUE_TEMPLATE_ARGS
+    bool USART_TX_QUEUE_TEMPLATE_QUALIFIER::Write(uint8_t data)
+    {
+        return Write(&data, 1) == 1;
+    }
+
+    USART_TX_QUEUE_TEMPLATE_ARGS
+    size_t USART_TX_QUEUE_TEMPLATE_QUALIFIER::FreeSpace()
+    {
+        return _queue.free_space();
+    }
+
+    USART_TX_QUEUE_TEMPLATE_ARGS
+    size_t USART_TX_QUEUE_TEMPLATE_QUALIFIER::Pending()
+    {
+        return _queue.size();
+    }
+
+    USART_TX_QUEUE_TEMPLATE_ARGS
+    bool USART_TX_QUEUE_TEMPLATE_QUALIFIER::Idle()
+    {
+        return !_busy && _queue.empty();
+    }
+
+    USART_TX_QUEUE_TEMPLATE_ARGS
+    uint32_t USART_TX_QUEUE_TEMPLATE_QUALIFIER::Rejected()
+    {
+        uint32_t rejected = _rejected;
+        _rejected = 0;
+        return rejected;
+    }
+
+    USART_TX_QUEUE_TEMPLATE_ARGS
+    void USART_TX_QUEUE_TEMPLATE_QUALIFIER::Flush()
+    {
+        while(!Idle())
+            continue;
+    }
+
+    USART_TX_QUEUE_TEMPLATE_ARGS
+    void USART_TX_QUEUE_TEMPLATE_QUALIFIER::StartNext()
+    {
+        // Called by producer only when DMA is idle (so there is no concurrent TransferCompleted)
+        // and from TransferCompleted
+        auto chunk = _queue.read_region();
+        _chunk = chunk.size();
+        if(chunk.empty())
+        {
+            _busy = false;
+            return;
+        }
+
+        _busy = true;
+        DmaTx::SetTransferCallback(TransferCompleted);
+        _Usart::Regs::Get()->CR3 |= USART_CR3_DMAT;
+        DmaTx::Transfer(DmaTx::Mem2Periph | DmaTx::MemIncrement, chunk.data(), &_Usart::Regs::Get()->TRANSMIT_DATA_REG, chunk.size());
+    }
+
+    USART_TX_QUEUE_TEMPLATE_ARGS
+    void USART_TX_QUEUE_TEMPLATE_QUALIFIER::TransferCompleted(void*, unsigned, bool)
+    {
+        // Data of failed transfer is dropped too: there is no way to find out sent part
+        _queue.consume(_chunk);
+        StartNext();
+    }
+} // namespace Zhele
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_IMPL_USART_STREAM_H
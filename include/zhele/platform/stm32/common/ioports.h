@@ -381,6 +381,8 @@ namespace Zhele
             class PortImplementation : public NativePortBase
             {
             public:
+                using Regs = _Regs;
+
                 /**
                  * @brief Send value to port
                  * 
@@ -12,8 +12,174 @@
 #include <bit>
 #include <cstdint>
 
+#if defined(ZHELE_HOST_REGISTERS)
+    #include <zhele/common/host/register_file.h>
+
+    /**
+     * @brief Notify host register file about register access
+     * 
+     * @details
+     * Expands to nothing in target build.
+     */
+    #define ZHELE_HOST_TOUCH(ADDRESS, SIZE) ::Zhele::Host::RegisterFile::Touch(::Zhele::Host::AddressOf(ADDRESS), SIZE)
+#else
+    #define ZHELE_HOST_TOUCH(ADDRESS, SIZE)
+#endif
+
+#if !defined(ZHELE_BITBAND) && !defined(ZHELE_HOST_REGISTERS) && (defined(STM32F1) || defined(STM32F4))
+    /**
+     * @brief Core has bit-band regions (Cortex-M3/M4 of F1/F4 families)
+     */
+    #define ZHELE_BITBAND
+#endif
+
 namespace Zhele
 {
+#if defined(ZHELE_HOST_REGISTERS)
+    namespace Host
+    {
+        /**
+         * @brief Maps STM32 address windows: APB/AHB1 peripherals, AHB2 peripherals (OTG, G0 IOPORT)
+         * and Cortex-M private peripherals (NVIC, SysTick, DWT, SCB)
+         * 
+         * @retval true All windows are mapped
+         * @retval false Some window was not mapped
+         */
+        inline bool MapDeviceWindows()
+        {
+            return RegisterFile::Map(0x40000000, 0x00080000)
+                && RegisterFile::Map(0x50000000, 0x00080000)
+                && RegisterFile::Map(0xe0000000, 0x00100000);
+        }
+
+        inline const bool DeviceWindowsMapped = MapDeviceWindows();
+    }
+#endif
+
+    /**
+     * @brief Single bit access via bit-band alias regions
+     * 
+     * @details
+     * Bit-band alias maps each bit of SRAM (0x20000000) and peripheral (0x40000000) regions
+     * to word, so set/clear is one store (atomic against interrupts) and bit check is one load.
+     * On cores without bit-band (and for addresses out of regions) access falls back
+     * to read-modify-write.
+     */
+    namespace BitBand
+    {
+        constexpr uint32_t RegionSize = 0x00100000; ///< Size of bit-band region
+        constexpr uint32_t SramBase = 0x20000000; ///< SRAM bit-band region base
+        constexpr uint32_t PeriphBase = 0x40000000; ///< Peripheral bit-band region base
+        constexpr uint32_t AliasOffset = 0x02000000; ///< Offset of alias region from bit-band region
+
+        /**
+         * @brief Check that address is in bit-band region
+         * 
+         * @param [in] address Address
+         * 
+         * @retval true Address is in SRAM or peripheral bit-band region
+         * @retval false Address is out of bit-band regions
+         */
+        constexpr bool InRegion(uint32_t address)
+        {
+            return (address - SramBase) < RegionSize || (address - PeriphBase) < RegionSize;
+        }
+
+        /**
+         * @brief Calculate alias word address of bit
+         * 
+         * @param [in] address Address in bit-band region
+         * @param [in] bit Bit number (relative to address, can be greater than 7)
+         * 
+         * @returns Alias word address
+         */
+        constexpr uint32_t Alias(uint32_t address, unsigned bit)
+        {
+            return (address & ~(RegionSize - 1)) + AliasOffset + ((address & (RegionSize - 1)) << 5) + (bit << 2);
+        }
+
+        /**
+         * @brief Set bit
+         * 
+         * @param [in] value Register (or variable)
+         * @param [in] bit Bit number
+         * 
+         * @par Returns
+         *	Nothing
+         */
+        template<typename _DataType>
+        inline void Set(volatile _DataType& value, unsigned bit)
+        {
+        #if defined(ZHELE_BITBAND)
+            if(uint32_t address = reinterpret_cast<uintptr_t>(&value); InRegion(address))
+            {
+                *reinterpret_cast<volatile uint32_t*>(Alias(address, bit)) = 1;
+                return;
+            }
+        #endif
+            value = value | static_cast<_DataType>(1u << bit);
+        }
+
+        /**
+         * @brief Clear bit
+         * 
+         * @param [in] value Register (or variable)
+         * @param [in] bit Bit number
+         * 
+         * @par Returns
+         *	Nothing
+         */
+        template<typename _DataType>
+        inline void Clear(volatile _DataType& value, unsigned bit)
+        {
+        #if defined(ZHELE_BITBAND)
+            if(uint32_t address = reinterpret_cast<uintptr_t>(&value); InRegion(address))
+            {
+                *reinterpret_cast<volatile uint32_t*>(Alias(address, bit)) = 0;
+                return;
+            }
+        #endif
+            value = value & static_cast<_DataType>(~(1u << bit));
+        }
+
+        /**
+         * @brief Write bit
+         * 
+         * @param [in] value Register (or variable)
+         * @param [in] bit Bit number
+         * @param [in] state New bit state
+         * 
+         * @par Returns
+         *	Nothing
+         */
+        template<typename _DataType>
+        inline void Write(volatile _DataType& value, unsigned bit, bool state)
+        {
+            if(state)
+                Set(value, bit);
+            else
+                Clear(value, bit);
+        }
+
+        /**
+         * @brief Check bit
+         * 
+         * @param [in] value Register (or variable)
+         * @param [in] bit Bit number
+         * 
+         * @retval true Bit is set
+         * @retval false Bit is clear
+         */
+        template<typename _DataType>
+        inline bool IsSet(const volatile _DataType& value, unsigned bit)
+        {
+        #if defined(ZHELE_BITBAND)
+            if(uint32_t address = reinterpret_cast<uintptr_t>(&value); InRegion(address))
+                return *reinterpret_cast<const volatile uint32_t*>(Alias(address, bit)) != 0;
+        #endif
+            return (value & (1u << bit)) != 0;
+        }
+    }
 
     /**
      * @brief Declare class with bit operations
@@ -30,32 +196,40 @@ namespace Zhele
     {\
     public:\
         using DataT = DATA_TYPE;\
-        static DataT Get(){return REG_NAME;}\
-        static void Set(DataT value){REG_NAME = value;}\
-        static void Or(DataT value){REG_NAME |= value;}\
-        static void And(DataT value){REG_NAME &= value;}\
-        static void Xor(DataT value){REG_NAME ^= value;}\
-        static void AndOr(DataT andMask, DataT orMask){REG_NAME = (REG_NAME & andMask) | orMask;}\
+        static DataT Get(){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(DataT)); return REG_NAME;}\
+        static void Set(DataT value){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(DataT)); REG_NAME = value;}\
+        static void Or(DataT value){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(DataT)); REG_NAME |= value;}\
+        static void And(DataT value){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(DataT)); REG_NAME &= value;}\
+        static void Xor(DataT value){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(DataT)); REG_NAME ^= value;}\
+        static void AndOr(DataT andMask, DataT orMask){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(DataT)); REG_NAME = (REG_NAME & andMask) | orMask;}\
         template<unsigned Bit>\
-        static bool IsBitSet(){return REG_NAME & (1u << Bit);}\
+        static void SetBit(){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(DataT)); ::Zhele::BitBand::Set(REG_NAME, Bit);}\
         template<unsigned Bit>\
-        static bool IsBitClear(){return !(REG_NAME & (1u << Bit));}\
+        static void ClearBit(){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(DataT)); ::Zhele::BitBand::Clear(REG_NAME, Bit);}\
+        template<unsigned Bit>\
+        static bool IsBitSet(){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(DataT)); return ::Zhele::BitBand::IsSet(REG_NAME, Bit);}\
+        template<unsigned Bit>\
+        static bool IsBitClear(){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(DataT)); return !::Zhele::BitBand::IsSet(REG_NAME, Bit);}\
     }
 
     template<uint32_t _Address, typename _DataType>
     class RegisterWrapper
     {
     public:
-        static _DataType Get(){return  *reinterpret_cast<_DataType*>(_Address);}
-        static void Set(_DataType value){ *reinterpret_cast<_DataType*>(_Address) = value;}
-        static void Or(_DataType value){ *reinterpret_cast<_DataType*>(_Address) |= value;}
-        static void And(_DataType value){ *reinterpret_cast<_DataType*>(_Address) &= value;}
-        static void Xor(_DataType value){ *reinterpret_cast<_DataType*>(_Address) ^= value;}
-        static void AndOr(_DataType andMask, _DataType orMask){ *reinterpret_cast<_DataType*>(_Address) = ( *reinterpret_cast<_DataType*>(_Address) & andMask) | orMask;}
+        static _DataType Get(){ZHELE_HOST_TOUCH(_Address, sizeof(_DataType)); return  *reinterpret_cast<_DataType*>(_Address);}
+        static void Set(_DataType value){ZHELE_HOST_TOUCH(_Address, sizeof(_DataType)); *reinterpret_cast<_DataType*>(_Address) = value;}
+        static void Or(_DataType value){ZHELE_HOST_TOUCH(_Address, sizeof(_DataType)); *reinterpret_cast<_DataType*>(_Address) |= value;}
+        static void And(_DataType value){ZHELE_HOST_TOUCH(_Address, sizeof(_DataType)); *reinterpret_cast<_DataType*>(_Address) &= value;}
+        static void Xor(_DataType value){ZHELE_HOST_TOUCH(_Address, sizeof(_DataType)); *reinterpret_cast<_DataType*>(_Address) ^= value;}
+        static void AndOr(_DataType andMask, _DataType orMask){ZHELE_HOST_TOUCH(_Address, sizeof(_DataType)); *reinterpret_cast<_DataType*>(_Address) = ( *reinterpret_cast<_DataType*>(_Address) & andMask) | orMask;}
+        template<unsigned Bit>
+        static void SetBit(){ZHELE_HOST_TOUCH(_Address, sizeof(_DataType)); BitBand::Set(*reinterpret_cast<volatile _DataType*>(_Address), Bit);}
         template<unsigned Bit>
-        static bool IsBitSet(){return  *reinterpret_cast<_DataType*>(_Address) & (1u << Bit);}
+        static void ClearBit(){ZHELE_HOST_TOUCH(_Address, sizeof(_DataType)); BitBand::Clear(*reinterpret_cast<volatile _DataType*>(_Address), Bit);}
         template<unsigned Bit>
-        static bool IsBitClear(){return !( *reinterpret_cast<_DataType*>(_Address) & (1u << Bit));}
+        static bool IsBitSet(){ZHELE_HOST_TOUCH(_Address, sizeof(_DataType)); return BitBand::IsSet(*reinterpret_cast<volatile _DataType*>(_Address), Bit);}
+        template<unsigned Bit>
+        static bool IsBitClear(){ZHELE_HOST_TOUCH(_Address, sizeof(_DataType)); return !BitBand::IsSet(*reinterpret_cast<volatile _DataType*>(_Address), Bit);}
     };
 
     /**
@@ -74,8 +248,8 @@ namespace Zhele
     {\
     public:\
         using DataT = STRUCT_TYPE;\
-        static DataT* Get(){return ((DataT*)STRUCT_PTR);}\
-        DataT* operator->(){return ((DataT*)(STRUCT_PTR));}\
+        static DataT* Get(){ZHELE_HOST_TOUCH(STRUCT_PTR, sizeof(DataT)); return ((DataT*)STRUCT_PTR);}\
+        DataT* operator->(){ZHELE_HOST_TOUCH(STRUCT_PTR, sizeof(DataT)); return ((DataT*)(STRUCT_PTR));}\
     }
 
     /**
@@ -89,8 +263,8 @@ namespace Zhele
         using RegT = decltype(REG_NAME);\
         static constexpr RegT Mask = ((RegT(1u) << BITFIELD_LENGTH) - 1);\
         static constexpr unsigned MaxValue = (1u << BITFIELD_LENGTH) - 1;\
-        static DataT Get(){return static_cast<DataT>((REG_NAME >> BITFIELD_OFFSET) & Mask);}\
-        static void Set(DataT value){REG_NAME = (REG_NAME & ~(Mask << BITFIELD_OFFSET)) | (((RegT)value & Mask) << BITFIELD_OFFSET);}\
+        static DataT Get(){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(RegT)); return static_cast<DataT>((REG_NAME >> BITFIELD_OFFSET) & Mask);}\
+        static void Set(DataT value){ZHELE_HOST_TOUCH(&(REG_NAME), sizeof(RegT)); REG_NAME = (REG_NAME & ~(Mask << BITFIELD_OFFSET)) | (((RegT)value & Mask) << BITFIELD_OFFSET);}\
     }
     
     #define DECLARE_IO_BITFIELD_WRAPPER(REG_NAME, CLASS_NAME, CMSIS_DEFINE) \
@@ -120,6 +294,10 @@ namespace Zhele
         static void Xor(DataT){}
         static void AndOr(DataT, DataT){}
         template<unsigned Bit>
+        static void SetBit(){}
+        template<unsigned Bit>
+        static void ClearBit(){}
+        template<unsigned Bit>
         static bool IsBitSet(){return false;}
         template<unsigned Bit>
         static bool IsBitClear(){return true;}
@@ -136,12 +314,108 @@ namespace Zhele
     class IoBit
     {
     public:
-        static volatile _DataType& Value(){ return *reinterpret_cast<_DataType*>(_RegAddr);}
+        static volatile _DataType& Value(){ ZHELE_HOST_TOUCH(_RegAddr, sizeof(_DataType)); return *reinterpret_cast<_DataType*>(_RegAddr);}
         static bool IsSet(){ return ((Value() >> _BitfieldOffset) & 0x01) != 0; }
         static void Set(){ Value() |= 1u << _BitfieldOffset; }
         static void Clear(){ Value() &= ~(1u << _BitfieldOffset); }
     };
 
+    /**
+     * @brief I/O register bit wrapper with bit-band access
+     * 
+     * @details
+     * Set and clear are single store to alias word (atomic against interrupts).
+     * Falls back to read-modify-write (like \ref IoBit) on cores without bit-band.
+     * 
+     * @tparam _RegAddr Register address (in peripheral bit-band region)
+     * @tparam _DataType Register data type
+     * @tparam _BitfieldOffset Bitfield offset in register
+     */
+    template<unsigned _RegAddr, typename _DataType, unsigned _BitfieldOffset>
+    class BitBandIoBit
+    {
+    #if defined(ZHELE_BITBAND)
+        static_assert(BitBand::InRegion(_RegAddr), "Register is out of bit-band region");
+    #endif
+    public:
+        static volatile _DataType& Value(){ ZHELE_HOST_TOUCH(_RegAddr, sizeof(_DataType)); return *reinterpret_cast<volatile _DataType*>(_RegAddr);}
+        static bool IsSet(){ return BitBand::IsSet(Value(), _BitfieldOffset); }
+        static void Set(){ BitBand::Set(Value(), _BitfieldOffset); }
+        static void Clear(){ BitBand::Clear(Value(), _BitfieldOffset); }
+    };
+
+    /**
+     * @brief Flags variable with atomic single flag access
+     * 
+     * @details
+     * Flag set/clear is single store to bit-band alias, so flags can be shared
+     * between interrupt handlers and main code without disabling interrupts.
+     * Object should be placed to SRAM bit-band region (not CCM), otherwise
+     * (and on cores without bit-band) access falls back to read-modify-write.
+     * 
+     * @par Example
+     * @code
+     * static BitBandFlags events;
+     * extern "C" void USART1_IRQHandler() { events.Set(RxEvent); }
+     * ...
+     * if(events.IsSet(RxEvent)) { events.Clear(RxEvent); ... }
+     * @endcode
+     */
+    class BitBandFlags
+    {
+    public:
+        /**
+         * @brief Set flag
+         * 
+         * @param [in] flag Flag number (0..31)
+         * 
+         * @par Returns
+         *	Nothing
+         */
+        void Set(unsigned flag) { BitBand::Set(_flags, flag); }
+
+        /**
+         * @brief Clear flag
+         * 
+         * @param [in] flag Flag number (0..31)
+         * 
+         * @par Returns
+         *	Nothing
+         */
+        void Clear(unsigned flag) { BitBand::Clear(_flags, flag); }
+
+        /**
+         * @brief Write flag
+         * 
+         * @param [in] flag Flag number (0..31)
+         * @param [in] state New flag state
+         * 
+         * @par Returns
+         *	Nothing
+         */
+        void Write(unsigned flag, bool state) { BitBand::Write(_flags, flag, state); }
+
+        /**
+         * @brief Check flag
+         * 
+         * @param [in] flag Flag number (0..31)
+         * 
+         * @retval true Flag is set
+         * @retval false Flag is clear
+         */
+        bool IsSet(unsigned flag) const { return BitBand::IsSet(_flags, flag); }
+
+        /**
+         * @brief Returns all flags
+         * 
+         * @returns Flags word
+         */
+        uint32_t Get() const { return _flags; }
+
+    private:
+        volatile uint32_t _flags = 0;
+    };
+
     /**
      * @brief Calculate bitfield length (for a contiguous, right-aligned mask) in compile-time
      *
@@ -0,0 +1,122 @@
+/**
+ * @file
+ * Implements 64-bit monotonic clock on hardware timer
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_MONOTONIC_CLOCK_H
+#define ZHELE_PLATFORM_STM32_COMMON_MONOTONIC_CLOCK_H
+
+#include <zhele/timer.h>
+
+#include <cstdint>
+#include <limits>
+
+namespace Zhele::Timers
+{
+    /**
+     * @brief Monotonic clock (64-bit tick count)
+     *
+     * @details
+     * Hardware timer counts freely (period 0xffff), compare channel interrupt occurs at each
+     * half of counter period and counts half periods (epoch). Time is epoch extended by counter value.
+     *
+     * Interrupt handler only increments epoch (single 32-bit store), reader never waits for it:
+     * if interrupt is pending (or reader has preempted handler), epoch parity differs from counter MSB
+     * and reader corrects epoch itself. Epoch is extended to 64 bits by the same way (high word is changed
+     * at each half of epoch range). So Now can be called from thread context and from any interrupt
+     * (including interrupts with higher priority than timer interrupt) without masking interrupts.
+     * The only requirement is timer interrupt latency less than half of counter period.
+     *
+     * @par Example
+     * @code
+     * using Clock = Timers::MonotonicClock<Timers::Timer2>;
+     *
+     * extern "C" void TIM2_IRQHandler() { Clock::IRQHandler(); }
+     *
+     * Clock::Init(1000000); // 1 us tick
+     * uint64_t start = Clock::Now();
+     * // ...
+     * uint64_t elapsedNs = Clock::ToNanoseconds(Clock::Now() - start);
+     * @endcode
+     *
+     * @tparam _Timer General-purpose timer (Timers::TimerN)
+     * @tparam _Channel Compare channel number (0..3)
+     */
+    template<typename _Timer, unsigned _Channel = 0>
+    class MonotonicClock
+    {
+        using Compare = typename _Timer::template OutputCompare<_Channel>;
+        using Counter = typename _Timer::Counter;
+
+        static constexpr unsigned CounterBits = std::numeric_limits<Counter>::digits;
+        static constexpr uint32_t HalfPeriod = 1u << (CounterBits - 1);
+        static constexpr uint32_t EpochHalfRange = 1u << 31;
+
+    public:
+        using Ticks = uint64_t;
+
+        /**
+         * @brief Configures hardware timer and starts clock from zero
+         *
+         * @param [in] tickFrequency Tick frequency (Hz), timer clock / tickFrequency should fit prescaler
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Init(unsigned tickFrequency);
+
+        /**
+         * @brief Returns tick frequency
+         *
+         * @returns Tick frequency (Hz)
+         */
+        static unsigned Frequency();
+
+        /**
+         * @brief Returns current time
+         *
+         * @returns Ticks since Init
+         */
+        static Ticks Now();
+
+        /**
+         * @brief Returns current time in nanoseconds
+         *
+         * @returns Nanoseconds since Init
+         */
+        static uint64_t NowNs();
+
+        /**
+         * @brief Converts ticks to nanoseconds
+         *
+         * @param [in] ticks Ticks
+         *
+         * @returns Nanoseconds
+         */
+        static uint64_t ToNanoseconds(Ticks ticks);
+
+        /**
+         * @brief Compare interrupt handler
+         *
+         * @details
+         * Call it from timer IRQ handler (it checks own flag, so timer interrupt can be shared).
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void IRQHandler();
+
+    private:
+        static inline volatile uint32_t _epoch = 0;
+        static inline volatile uint32_t _high = 0;
+        static inline unsigned _frequency = 1;
+    };
+}
+
+#include "impl/monotonic_clock.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_MONOTONIC_CLOCK_H
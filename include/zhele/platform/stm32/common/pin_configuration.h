@@ -0,0 +1,167 @@
+/**
+ * @file
+ * Implements GPIO configuration aggregator
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_PIN_CONFIGURATION_H
+#define ZHELE_PLATFORM_STM32_COMMON_PIN_CONFIGURATION_H
+
+#include <zhele/iopins.h>
+#include <zhele/pinlist.h>
+#include <zhele/common/template_utils/type_list.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace Zhele::IO
+{
+    /**
+     * @brief Settings of pin (or all pins of pin list) for \ref PinConfiguration
+     *
+     * @details
+     * Options can be given in any order and are recognized by type: driver type, pull mode,
+     * speed (enums of pin port) and alternate function number (integer). Skipped options are not written.
+     *
+     * @par Example
+     * @code
+     * using UartPins = PinSettings<IO::Pa9, IO::Pa9::Configuration::AltFunc, IO::Pa9::Speed::Fast, uint8_t(7)>;
+     * @endcode
+     *
+     * @tparam _Pins Pin or pin list
+     * @tparam _Configuration Pin configuration (Configuration enum of pin port)
+     * @tparam _Options Optional settings
+     */
+    template<typename _Pins, auto _Configuration, auto... _Options>
+    struct PinSettings
+    {
+    };
+
+    /**
+     * @brief Final configuration registers values of one port
+     *
+     * @details
+     * Mask has ones for bits given by settings, other bits of register are kept.
+     */
+    struct PortConfigurationImage
+    {
+    #if defined(GPIO_CRL_MODE0)
+        uint32_t CrlMask = 0; ///< Configured bits of CRL
+        uint32_t Crl = 0; ///< CRL value
+        uint32_t CrhMask = 0; ///< Configured bits of CRH
+        uint32_t Crh = 0; ///< CRH value
+        uint32_t Bsrr = 0; ///< Pull-up (set) and pull-down (reset) bits of input pins
+    #else
+        uint32_t ModerMask = 0; ///< Configured bits of MODER
+        uint32_t Moder = 0; ///< MODER value
+        uint32_t OtyperMask = 0; ///< Configured bits of OTYPER
+        uint32_t Otyper = 0; ///< OTYPER value
+        uint32_t OspeedrMask = 0; ///< Configured bits of OSPEEDR
+        uint32_t Ospeedr = 0; ///< OSPEEDR value
+        uint32_t PupdrMask = 0; ///< Configured bits of PUPDR
+        uint32_t Pupdr = 0; ///< PUPDR value
+        uint32_t AfrMask[2] {}; ///< Configured bits of AFR
+        uint32_t Afr[2] {}; ///< AFR values
+    #endif
+        bool Conflict = false; ///< Some pin has different settings
+    };
+
+    namespace Private
+    {
+        /**
+         * @brief Settings of one pin (negative value for not given setting)
+         */
+        struct PinAttributes
+        {
+            int8_t Configuration = -1;
+            int8_t Driver = -1;
+            int8_t Pull = -1;
+            int8_t Speed = -1;
+            int8_t AltFunc = -1;
+        };
+
+        /**
+         * @brief Settings of all pins of port
+         */
+        struct PortAttributes
+        {
+            PinAttributes Pins[16];
+            bool Conflict = false;
+        };
+
+        template<typename _Settings>
+        struct PinSettingsTraits;
+    }
+
+    /**
+     * @brief Compile-time GPIO configuration of many drivers
+     *
+     * @details
+     * Settings of all pins are folded into final per-port register images at compile time,
+     * so \ref Apply writes each configuration register once (read-modify-write only if some pins
+     * of register are not configured) instead of read-modify-write per setting call.
+     * Same pin can be listed several times with equal settings, different settings
+     * of one pin are reported by static assertion in \ref Apply.
+     *
+     * On F1 (CRL/CRH layout) driver type and speed are applied to output and alternate function pins,
+     * pull mode to input pins only; alternate function numbers are ignored (there is no AFR).
+     *
+     * @par Example
+     * @code
+     * using Spi1Pins = template_utils::type_list<
+     *     PinSettings<PinList<IO::Pa5, IO::Pa7>, IO::Pa5::Configuration::AltFunc, IO::Pa5::Speed::Fast, uint8_t(5)>,
+     *     PinSettings<IO::Pa6, IO::Pa6::Configuration::In, IO::Pa6::PullMode::PullUp>>;
+     * using Leds = PinSettings<PinList<IO::Pc13, IO::Pc14>, IO::Pc13::Configuration::Out>;
+     *
+     * PinConfiguration<Spi1Pins, Leds>::Apply();
+     * @endcode
+     *
+     * @tparam _Settings Pin settings (\ref PinSettings) or type lists of them
+     */
+    template<typename... _Settings>
+    class PinConfiguration
+    {
+        static constexpr auto _settings = (template_utils::type_list<>{} + ... + Private::PinSettingsTraits<_Settings>::Flatten);
+        static constexpr auto _ports = _settings.accumulate([](auto settings) {
+            return Private::PinSettingsTraits<typename decltype(settings)::type>::Ports;
+        }).remove_duplicates();
+
+        template<typename _Port>
+        static consteval PortConfigurationImage MakeImage();
+
+        template<typename _Port>
+        static void WriteImage();
+
+    public:
+        /**
+         * @brief Register values of port
+         *
+         * @tparam _Port Port
+         */
+        template<typename _Port>
+        static constexpr PortConfigurationImage Image = MakeImage<_Port>();
+
+        /**
+         * @brief Check that some pin has different settings
+         *
+         * @retval true Settings have conflict
+         * @retval false No conflicts
+         */
+        static consteval bool HasConflicts();
+
+        /**
+         * @brief Enables clocks of ports and writes configuration registers
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Apply();
+    };
+}
+
+#include "impl/pin_configuration.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_PIN_CONFIGURATION_H
@@ -0,0 +1,173 @@
+/**
+ * @file
+ * Implements pulse train capture by DMA with frame detection
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_PULSE_CAPTURE_H
+#define ZHELE_PLATFORM_STM32_COMMON_PULSE_CAPTURE_H
+
+#include <zhele/timer.h>
+#include <zhele/containers/spsc_ring_buffer.h>
+
+#include <cstdint>
+
+namespace Zhele::Timers
+{
+    /**
+     * @brief Pulse train capture (IR remotes, 433 MHz receivers, frequency measurement)
+     *
+     * @details
+     * Edges of channel 1 input (TI1) reset timer counter (slave reset mode), capture channel 1 latches
+     * counter before reset, so DMA records interval between each edge and previous one to circular buffer.
+     * Frame ends when input has no edges for gap ticks: timeout compare channel matches counter,
+     * its interrupt queues frame (position and length in buffer). Frames are decoded from thread context
+     * (\ref ReadFrame), interrupt handler does not depend on edges count: the first edge of frame
+     * and frame end take one interrupt each (timeout interrupt is disabled while input is idle,
+     * capture interrupt of first edge enables it).
+     *
+     * Frame is stored in circular buffer, so it must be read before _Size next edges overwrite it.
+     * Gap must be less than counter period, interrupt latency must be less than interval between edges.
+     *
+     * @par Example
+     * @code
+     * using Receiver = Timers::PulseCapture<Timers::Timer3, Dma1Channel6>;
+     *
+     * extern "C" void TIM3_IRQHandler() { Receiver::IRQHandler(); }
+     *
+     * Receiver::Capture::SelectPins<IO::Pa6>();
+     * Receiver::Init(1000000, 10000); // 1 us tick, frame ends after 10 ms of silence
+     * Drivers::NecDecoder::SetCallback([](auto command) { ... });
+     *
+     * Receiver::Frame frame;
+     * while(Receiver::ReadFrame(frame))
+     *     Drivers::NecDecoder::Decode(frame);
+     * @endcode
+     *
+     * @tparam _Timer General-purpose timer with slave mode controller (Timers::TimerN)
+     * @tparam _DmaChannel DMA channel (stream) connected to channel 1 capture request
+     * @tparam _Size Buffer size (intervals), power of two
+     * @tparam _Frames Frames queue size
+     * @tparam _TimeoutChannel Compare channel for gap detection (1..3)
+     */
+    template<typename _Timer, typename _DmaChannel, unsigned _Size = 256, unsigned _Frames = 4, unsigned _TimeoutChannel = 2>
+    class PulseCapture
+    {
+        static_assert(_Size >= 2 && _Size <= 0x8000 && (_Size & (_Size - 1)) == 0, "Buffer size should be power of two");
+        static_assert(_TimeoutChannel >= 1 && _TimeoutChannel <= 3, "Channel 1 is used for capture");
+
+        static constexpr uint16_t Mask = _Size - 1;
+
+        using Timeout = typename _Timer::template OutputCompare<_TimeoutChannel>;
+
+    public:
+        using Capture = typename _Timer::template InputCapture<0>;
+        using Counter = typename _Timer::Counter;
+
+        /// Captured edges
+        enum class Edges : uint8_t
+        {
+            Both,    ///< Rising and falling edges (TI1 edge detector)
+            Rising,  ///< Rising edges
+            Falling, ///< Falling edges
+        };
+
+        /**
+         * @brief Received frame
+         *
+         * @details
+         * Frame is a view of capture buffer. Intervals follow first edge of frame, for Edges::Both
+         * they alternate input levels (first interval is level after first edge).
+         */
+        class Frame
+        {
+            friend class PulseCapture;
+        public:
+            /**
+             * @brief Returns intervals count
+             *
+             * @returns Count of intervals (edges count - 1)
+             */
+            uint16_t Size() const
+            {
+                return _edges - 1;
+            }
+
+            /**
+             * @brief Returns interval
+             *
+             * @param [in] index Interval index (0..Size()-1)
+             *
+             * @returns Interval (ticks)
+             */
+            Counter operator[](uint16_t index) const
+            {
+                return _buffer[(_start + 1 + index) & Mask];
+            }
+
+        private:
+            uint16_t _start = 0;
+            uint16_t _edges = 1;
+        };
+
+        /**
+         * @brief Configures timer and starts capture
+         *
+         * @param [in] tickFrequency Tick frequency (Hz), timer clock / tickFrequency should fit prescaler
+         * @param [in] gap Silence interval that ends frame (ticks)
+         * @param [in] edges Captured edges
+         * @param [in] channel DMA channel (for DMA with streams)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Init(unsigned tickFrequency, Counter gap, Edges edges = Edges::Both ONLY_IF_STREAM_SUPPORTED(COMMA uint8_t channel = 0));
+
+        /**
+         * @brief Take next received frame
+         *
+         * @param [out] frame Frame
+         *
+         * @retval true Frame is taken
+         * @retval false There is no received frames
+         */
+        static bool ReadFrame(Frame& frame);
+
+        /**
+         * @brief Returns count of frames dropped because of full queue
+         *
+         * @returns Dropped frames
+         */
+        static uint32_t DroppedFrames();
+
+        /**
+         * @brief Timer interrupt handler
+         *
+         * @details
+         * Call it from timer IRQ handler (timer interrupt should not be used by other features).
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void IRQHandler();
+
+    private:
+        using Dma = typename Capture::template DmaCapture<_DmaChannel>;
+
+        static void WaitFirstEdge();
+
+        static inline Counter _buffer[_Size] {};
+        static inline Containers::SpscRingBuffer<_Frames, Frame> _frames;
+        static inline Counter _gap = 0;
+        static inline uint16_t _frameStart = 0;
+        static inline uint32_t _dropped = 0;
+        static inline bool _armed = false;
+    };
+}
+
+#include "impl/pulse_capture.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_PULSE_CAPTURE_H
@@ -0,0 +1,147 @@
+/**
+ * @file
+ * Implements software (bit-banged) I2C master
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_SOFT_I2C_H
+#define ZHELE_PLATFORM_STM32_COMMON_SOFT_I2C_H
+
+#include <zhele/cycle_counter.h>
+#include <zhele/i2c.h>
+
+#include <cstdint>
+
+namespace Zhele
+{
+    /**
+     * @brief Software I2C master on GPIO pins
+     *
+     * @details
+     * Class has the same static interface as hardware I2C (blocking part of it), so
+     * drivers templated by I2C (Bmp280, Hd44780Pcf8574...) work with it. SCL edges are
+     * scheduled by core cycle counter (see \ref CycleCounter). Clock stretching is supported,
+     * slave holding SCL longer than 1 ms fails operation with I2cStatus::Timeout.
+     * Lost arbitration is reported as I2cStatus::ArbitrationError.
+     *
+     * Pins are configured as open-drain outputs, bus needs external pull-up resistors.
+     *
+     * @par Example
+     * @code
+     * using I2c = SoftI2c<IO::Pb6, IO::Pb7>;
+     * I2c::Init<400000>();
+     * auto id = I2c::ReadU8(0x76, 0xd0);
+     * @endcode
+     *
+     * @tparam _SclPin SCL pin
+     * @tparam _SdaPin SDA pin
+     * @tparam _CoreFreq Core clock frequency (optional parameter)
+     */
+    template<typename _SclPin, typename _SdaPin, unsigned long _CoreFreq = F_CPU>
+    class SoftI2c
+    {
+        static constexpr CycleCounter::Ticks StretchTimeout = _CoreFreq / 1000;
+    public:
+        /**
+         * @brief Initializes I2C
+         *
+         * @param [in] i2cClockSpeed SCL frequency
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Init(uint32_t i2cClockSpeed = 100000U);
+
+        /**
+         * @brief Initializes I2C
+         *
+         * @details
+         * Half period of SCL is computed at compile time from core clock frequency.
+         *
+         * @tparam _SclFreq SCL frequency
+         *
+         * @par Returns
+         *	Nothing
+         */
+        template<uint32_t _SclFreq>
+        static void Init();
+
+        /**
+         * @brief Writes one byte to device register
+         *
+         * @param [in] devAddr Device address
+         * @param [in] regAddr Register address
+         * @param [in] data Data
+         * @param [in] opts Options
+         *
+         * @returns Operation status
+         */
+        static I2cStatus WriteU8(uint16_t devAddr, uint16_t regAddr, uint8_t data, I2cOpts opts = I2cOpts::None);
+
+        /**
+         * @brief Writes data to device
+         *
+         * @param [in] devAddr Device address
+         * @param [in] regAddr Register address
+         * @param [in] data Data
+         * @param [in] size Data size
+         * @param [in] opts Options
+         *
+         * @returns Operation status
+         */
+        static I2cStatus Write(uint16_t devAddr, uint16_t regAddr, const uint8_t *data, uint16_t size, I2cOpts opts = I2cOpts::None);
+
+        /**
+         * @brief Reads one byte from device register
+         *
+         * @param [in] devAddr Device address
+         * @param [in] regAddr Register address
+         * @param [in] opts Options
+         *
+         * @returns Read value and operation status
+         */
+        static ReadResult ReadU8(uint16_t devAddr, uint16_t regAddr, I2cOpts opts = I2cOpts::None);
+
+        /**
+         * @brief Reads data from device
+         *
+         * @param [in] devAddr Device address
+         * @param [in] regAddr Register address
+         * @param [out] data Output buffer
+         * @param [in] size Data size
+         * @param [in] opts Options
+         *
+         * @returns Operation status
+         */
+        static I2cStatus Read(uint16_t devAddr, uint16_t regAddr, uint8_t *data, uint16_t size, I2cOpts opts = I2cOpts::None);
+
+        /**
+         * @brief Check that bus is busy (SCL or SDA is low)
+         *
+         * @retval true Bus is busy
+         * @retval false Bus is free
+         */
+        static bool Busy();
+
+    private:
+        static I2cStatus Start(bool repeated);
+        static I2cStatus Stop(I2cStatus status);
+        static I2cStatus ReleaseClock();
+        static I2cStatus WriteBit(bool bit);
+        static I2cStatus ReadBit(bool& bit);
+        static I2cStatus WriteByte(uint8_t data);
+        static I2cStatus ReadByte(uint8_t& data, bool ack);
+        static I2cStatus WriteDevAddr(uint16_t devAddr, bool read, I2cOpts opts, bool repeated);
+        static I2cStatus WriteRegAddr(uint16_t regAddr, I2cOpts opts);
+
+        static inline CycleCounter::Ticks _halfPeriod = _CoreFreq / (2 * 100000U);
+        static inline CycleCounter::Ticks _edge = 0;
+    };
+}
+
+#include "impl/soft_i2c.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_SOFT_I2C_H
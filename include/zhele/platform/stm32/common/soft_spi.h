@@ -0,0 +1,233 @@
+/**
+ * @file
+ * Implements software (bit-banged) SPI master
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_SOFT_SPI_H
+#define ZHELE_PLATFORM_STM32_COMMON_SOFT_SPI_H
+
+#include <zhele/cycle_counter.h>
+#include <zhele/iopins.h>
+#include <zhele/spi.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Zhele
+{
+    /**
+     * @brief Software SPI master on GPIO pins
+     *
+     * @details
+     * Class has the same static interface as hardware SPI (blocking part of it), so
+     * drivers templated by SPI (Rc522, for example) work with it. Clock edges are scheduled
+     * by core cycle counter (see \ref CycleCounter), so bit rate doesn't depend on compiler
+     * optimization. Like hardware SPI clocked from bus clock, SPI clock is core clock / divider.
+     * If half period is shorter than pins access code, SPI runs as fast as code allows.
+     *
+     * Only master mode is supported, there are no async (DMA) methods.
+     *
+     * @par Example
+     * @code
+     * using Spi = SoftSpi<IO::Pb15, IO::Pb14, IO::Pb13>;
+     * Spi::Init(Spi::Div16); // 4.5 MHz at 72 MHz core clock
+     * uint8_t answer = Spi::Send(0x42);
+     * @endcode
+     *
+     * @tparam _MosiPin MOSI pin (IO::NullPin for receive only)
+     * @tparam _MisoPin MISO pin (IO::NullPin for transmit only)
+     * @tparam _ClockPin SCK pin
+     * @tparam _SsPin SS pin controlled by SetSS/ClearSS (optional parameter)
+     * @tparam _CoreFreq Core clock frequency (optional parameter)
+     */
+    template<typename _MosiPin, typename _MisoPin, typename _ClockPin, typename _SsPin = IO::NullPin, unsigned long _CoreFreq = F_CPU>
+    class SoftSpi : public Private::SpiBase
+    {
+    public:
+        /**
+         * @brief Returns half period of SPI clock
+         *
+         * @param [in] divider Clock divider
+         *
+         * @returns Half period in core cycles
+         */
+        static constexpr CycleCounter::Ticks HalfPeriod(ClockDivider divider)
+        {
+            return CycleCounter::Ticks(1) << (divider >> SPI_CR1_BR_Pos);
+        }
+
+        /**
+         * @brief Enables pins ports and cycle counter
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Enable();
+
+        /**
+         * @brief Initializes SPI (mode 0, MSB first, 8-bit frames)
+         *
+         * @param [in] divider SPI clock divider (of core clock)
+         * @param [in] mode Mode (only master is supported)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Init(ClockDivider divider = Medium, Mode mode = Master);
+
+        /**
+         * @brief Initializes SPI with given clock (mode 0, MSB first, 8-bit frames)
+         *
+         * @details
+         * Half period is computed at compile time from core clock frequency.
+         *
+         * @tparam _ClockFreq SPI clock frequency
+         *
+         * @par Returns
+         *	Nothing
+         */
+        template<unsigned long _ClockFreq>
+        static void Init();
+
+        /**
+         * @brief Set clock divider
+         *
+         * @param [in] divider Clock divider
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void SetDivider(ClockDivider divider);
+
+        /**
+         * @brief Set clock polarity
+         *
+         * @param [in] clockPolarity Clock polarity
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void SetClockPolarity(ClockPolarity clockPolarity);
+
+        /**
+         * @brief Set clock phase
+         *
+         * @param [in] clockPhase Clock phase
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void SetClockPhase(ClockPhase clockPhase);
+
+        /**
+         * @brief Set bit order
+         *
+         * @param [in] bitOrder Bit order
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void SetBitOrder(BitOrder bitOrder);
+
+        /**
+         * @brief Set data size
+         *
+         * @param [in] dataSize Data size
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void SetDataSize(DataSize dataSize);
+
+        /**
+         * @brief Set SS pin (deselect slave)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void SetSS();
+
+        /**
+         * @brief Clear SS pin (select slave)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void ClearSS();
+
+        /**
+         * @brief Check that SPI is busy
+         *
+         * @details
+         * All transfers are blocking, so software SPI is never busy between calls.
+         *
+         * @retval false Not busy
+         */
+        static bool Busy();
+
+        /**
+         * @brief Sends frame and receives answer
+         *
+         * @param [in] value Value to send
+         *
+         * @returns Received frame
+         */
+        static uint16_t Send(uint16_t value);
+
+        /**
+         * @brief Full-duplex blocking transfer
+         *
+         * @tparam _DataSize Frame size of buffers (8-bit or 16-bit frames storage)
+         *
+         * @param [in] transmitBuffer Data to transmit (nullptr to send 0xff)
+         * @param [out] receiveBuffer Receive buffer (nullptr to ignore received data)
+         * @param [in] count Frames count
+         *
+         * @par Returns
+         *	Nothing
+         */
+        template<DataSize _DataSize = DataSize8>
+        static void Transfer(const void* transmitBuffer, void* receiveBuffer, size_t count);
+
+        /**
+         * @brief Writes frame
+         *
+         * @param [in] data Frame to write
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Write(uint16_t data);
+
+        /**
+         * @brief Reads frame (sends 0xffff)
+         *
+         * @returns Received frame
+         */
+        static uint16_t Read();
+
+    private:
+        static constexpr unsigned FrameBits(DataSize dataSize)
+        {
+        #if defined(SPI_CR1_DFF)
+            return dataSize == DataSize16 ? 16 : 8;
+        #else
+            return (dataSize >> SPI_CR2_DS_Pos) + 1;
+        #endif
+        }
+
+        static inline CycleCounter::Ticks _halfPeriod = HalfPeriod(Medium);
+        static inline bool _idleHigh = false;
+        static inline bool _sampleOnTrailingEdge = false;
+        static inline bool _lsbFirst = false;
+        static inline uint8_t _frameBits = 8;
+    };
+}
+
+#include "impl/soft_spi.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_SOFT_SPI_H
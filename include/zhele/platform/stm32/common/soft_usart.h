@@ -0,0 +1,153 @@
+/**
+ * @file
+ * Implements software (bit-banged) USART
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_SOFT_USART_H
+#define ZHELE_PLATFORM_STM32_COMMON_SOFT_USART_H
+
+#include <zhele/cycle_counter.h>
+#include <zhele/iopins.h>
+#include <zhele/usart.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Zhele
+{
+    /**
+     * @brief Software USART (asynchronous mode) on GPIO pins
+     *
+     * @details
+     * Class has the same static interface as hardware USART (blocking part of it).
+     * Bit times are scheduled by core cycle counter (see \ref CycleCounter).
+     * Mode supports data bits (frame of 8 or 9 bits including parity bit, like hardware),
+     * parity, one or two stop bits and RX/TX enable flags.
+     *
+     * Receiver has no buffer: Read waits for start bit, so byte is received only if Read is called
+     * before its start bit. Interrupts during frame shift bit times, so transmit and receive
+     * should be done with interrupts disabled (or with short handlers) for high baud rates.
+     *
+     * @par Example
+     * @code
+     * using Usart = SoftUsart<IO::Pa2, IO::Pa3>;
+     * Usart::Init<9600>();
+     * Usart::Write("Hello", 5);
+     * @endcode
+     *
+     * @tparam _TxPin TX pin (IO::NullPin for receive only)
+     * @tparam _RxPin RX pin (IO::NullPin for transmit only)
+     * @tparam _CoreFreq Core clock frequency (optional parameter)
+     */
+    template<typename _TxPin, typename _RxPin, unsigned long _CoreFreq = F_CPU>
+    class SoftUsart : public UsartBase
+    {
+    public:
+        /**
+         * @brief Initialize USART
+         *
+         * @details
+         * Bit time is computed at compile time from core clock frequency.
+         *
+         * @tparam baud Baud rate
+         * @param [in] mode Mode
+         *
+         * @par Returns
+         *	Nothing
+         */
+        template<unsigned long baud>
+        static void Init(UsartMode mode = DefaultUsartMode);
+
+        /**
+         * @brief Initialize USART
+         *
+         * @param [in] baud Baud rate
+         * @param [in] mode Mode
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Init(unsigned baud, UsartMode mode = DefaultUsartMode);
+
+        /**
+         * @brief Set config (data bits, parity, stop bits, RX/TX enable)
+         *
+         * @param [in] mode Mode
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void SetConfig(UsartMode mode);
+
+        /**
+         * @brief Set baud rate
+         *
+         * @param [in] baud Baud rate
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void SetBaud(unsigned baud);
+
+        /**
+         * @brief Check that start bit is on RX line
+         *
+         * @retval true Start bit is received
+         * @retval false Line is idle
+         */
+        static bool ReadReady();
+
+        /**
+         * @brief Receives byte (waits for start bit)
+         *
+         * @returns Received byte
+         */
+        static uint8_t Read();
+
+        /**
+         * @brief Check that USART is ready to write
+         *
+         * @details
+         * All writes are blocking, so software USART is always ready.
+         *
+         * @retval true Ready
+         */
+        static bool WriteReady();
+
+        /**
+         * @brief Writes data
+         *
+         * @param [in] data Data
+         * @param [in] size Data size
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Write(const void* data, size_t size);
+
+        /**
+         * @brief Writes byte
+         *
+         * @param [in] data Byte
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Write(uint8_t data);
+
+    private:
+        static inline CycleCounter::Ticks _bitTime = _CoreFreq / 9600;
+        static inline uint8_t _dataBits = 8;
+        static inline bool _parity = false;
+        static inline bool _oddParity = false;
+        static inline uint8_t _stopBits = 1;
+    };
+}
+
+#include "impl/soft_usart.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_SOFT_USART_H
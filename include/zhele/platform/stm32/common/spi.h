@@ -158,6 +158,7 @@ namespace Zhele
         public:
             using DmaTx = _DmaTx;
             using DmaRx = _DmaRx;
+            using Regs = _Regs;
             using TransferCallback = DmaChannelData::TransferCallback;
             /**
              * @brief Enable SPI
@@ -285,6 +286,29 @@ namespace Zhele
              * @returns Received value
              */
             static uint16_t Send(uint16_t value);
+
+            /**
+             * @brief Polled block transfer with frame size known at compile time
+             * 
+             * @details
+             * Data register width is selected at compile time (no frame size checks),
+             * next frame is written while previous one is shifted, so SCK runs without gaps.
+             * On SPI with FIFO 8-bit frames are written and read in pairs (16-bit access).
+             * Transmit and receive buffers can be the same buffer. Frame size must be set
+             * by SetDataSize. Interrupt during transfer must not take longer than one frame
+             * (or receive overrun occurs), so disable interrupts for transfers with highest SCK.
+             * 
+             * @tparam _DataSize Frame size (DataSize8 or DataSize16 with DFF, any with DS)
+             * 
+             * @param [in] transmitBuffer Data to transmit (nullptr to send 0xff)
+             * @param [out] receiveBuffer Received data (nullptr to ignore)
+             * @param [in] count Frames count
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            template<DataSize _DataSize = DataSize8>
+            static void Transfer(const void* transmitBuffer, void* receiveBuffer, size_t count);
            
             /**
              * @brief Send data async (by DMA)
@@ -321,6 +345,18 @@ namespace Zhele
              */
             static void WriteAsync(const void* data, uint16_t size, TransferCallback callback = nullptr);
 
+            /**
+             * @brief Send descriptor list async (gathered write by DMA) with ignored receive
+             * 
+             * @param [in] descriptors Descriptor list (sizes are count of elements)
+             * @param [in] count Descriptors count
+             * @param [in, opt] callback Transfer complete callback (optional parameter)
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void WriteAsyncList(const DmaDescriptor* descriptors, uint16_t count, TransferCallback callback = nullptr);
+
             /**
              * @brief Send data async (by DMA) with ignored receive
              * 
@@ -393,6 +429,13 @@ namespace Zhele
              */
             template<typename mosiPin, typename misoPin, typename clockPin, typename ssPin>
             static void SelectPins();
+
+        private:
+            template<typename _Frame>
+            static void TransferFrames(const uint8_t* transmitBuffer, uint8_t* receiveBuffer, size_t count);
+
+            /// DMA transfer size of current frame size (set by SetDataSize), async methods don't read CR1/CR2
+            static inline typename _DmaTx::Mode _dmaDataSize = _DmaTx::PSize8Bits | _DmaTx::MSize8Bits;
         };
     }
 }
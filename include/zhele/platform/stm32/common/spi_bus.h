@@ -0,0 +1,236 @@
+/**
+ * @file
+ * Implements SPI bus transaction queue (shared SPI with several devices)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_SPI_BUS_H
+#define ZHELE_PLATFORM_STM32_COMMON_SPI_BUS_H
+
+#include <zhele/spi.h>
+#include <zhele/common/delegate.h>
+#include <zhele/containers/spsc_ring_buffer.h>
+
+#include <type_traits>
+
+namespace Zhele
+{
+    /**
+     * @brief SPI bus transaction
+     */
+    struct SpiBusTransaction
+    {
+        using SpiBase = Private::SpiBase;
+        using ChipSelect = std::add_pointer_t<void(bool select)>;
+        using Callback = Delegate<void(bool success)>;
+
+        ChipSelect Select; ///< Device chip select control
+        SpiBase::ClockDivider Divider; ///< Clock divider
+        SpiBase::ClockPolarity Polarity; ///< Clock polarity
+        SpiBase::ClockPhase Phase; ///< Clock phase
+        SpiBase::DataSize DataSize; ///< Frame size
+
+        const void* TransmitBuffer; ///< Data to transmit (nullptr to send 0xff)
+        void* ReceiveBuffer; ///< Receive buffer (nullptr to ignore received data)
+        uint16_t Count; ///< Frames count
+        bool KeepSelected; ///< Do not release chip select after transaction (command followed by data)
+        Callback OnComplete; ///< Transaction complete callback (called from DMA interrupt)
+    };
+
+    /**
+     * @brief SPI bus transaction queue
+     *
+     * @details
+     * Devices on shared SPI enqueue transactions (chip select, clock and frame settings, buffers).
+     * Bus executes them one by one by DMA: RX DMA transfer complete interrupt finishes transaction
+     * (releases chip select and calls callback) and starts next one, so CPU doesn't wait between transfers.
+     * SPI is reconfigured only if next transaction settings differ from current.
+     *
+     * SPI must be initialized (master, soft slave control). RX DMA interrupt handler must call
+     * DmaRx::IrqHandler. Transactions must be enqueued from one context (thread or interrupt),
+     * do not use SPI directly while bus is not idle.
+     *
+     * @par Example
+     * @code
+     * using Bus = SpiBus<Spi1>;
+     * using Display = SpiBusDevice<Bus, IO::Pa4, Spi1::Fastest>;
+     * using Card = SpiBusDevice<Bus, IO::Pb0, Spi1::Medium>;
+     * extern "C" void DMA1_Channel2_IRQHandler() { Spi1::DmaRx::IrqHandler(); }
+     *
+     * Display::Write(frame, sizeof(frame));
+     * Card::Transfer(command, response, sizeof(command), onResponse);
+     * @endcode
+     *
+     * @tparam _Spi SPI (with TX and RX DMA)
+     * @tparam _QueueSize Transactions queue size
+     */
+    template<typename _Spi, unsigned _QueueSize = 8>
+    class SpiBus
+    {
+        using DmaTx = typename _Spi::DmaTx;
+        using DmaRx = typename _Spi::DmaRx;
+        using Regs = typename _Spi::Regs;
+        static_assert(!std::is_same_v<DmaTx, void> && !std::is_same_v<DmaRx, void>, "SPI has no DMA");
+    public:
+        using Spi = _Spi;
+        using Transaction = SpiBusTransaction;
+
+        /**
+         * @brief Enqueue transaction
+         *
+         * @details
+         * Transaction starts immediately if bus is idle. Buffers must be valid until transaction completes.
+         *
+         * @param [in] transaction Transaction
+         *
+         * @retval true Transaction queued
+         * @retval false Queue is full
+         */
+        static bool Enqueue(const Transaction& transaction);
+
+        /**
+         * @brief Returns count of not completed transactions (including current)
+         *
+         * @returns Transactions count
+         */
+        static size_t Pending();
+
+        /**
+         * @brief Check that bus is idle
+         *
+         * @retval true All transactions are completed
+         * @retval false Transaction in progress
+         */
+        static bool Idle();
+
+        /**
+         * @brief Wait until all transactions complete
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Flush();
+
+    private:
+        static void StartNext();
+        static void Configure(const Transaction& transaction);
+        static void StartTransfer(const Transaction& transaction);
+        static void Complete(bool success);
+        static void TransferCompleted(void* data, unsigned size, bool success);
+
+        struct Configuration
+        {
+            Transaction::SpiBase::ClockDivider Divider;
+            Transaction::SpiBase::ClockPolarity Polarity;
+            Transaction::SpiBase::ClockPhase Phase;
+            Transaction::SpiBase::DataSize DataSize;
+
+            bool operator==(const Configuration&) const = default;
+        };
+
+        static inline Containers::SpscRingBuffer<_QueueSize, Transaction> _queue;
+        static inline volatile bool _busy = false;
+        static inline bool _configured = false;
+        static inline Configuration _configuration {};
+        static inline Transaction::ChipSelect _selected = nullptr;
+        static inline const uint16_t _dummy = 0xffff;
+        static inline uint16_t _sink = 0;
+    };
+
+    /**
+     * @brief Device on SPI bus
+     *
+     * @tparam _Bus SPI bus
+     * @tparam _CsPin Chip select pin (active low, must be configured as output)
+     * @tparam _Divider Clock divider
+     * @tparam _Polarity Clock polarity
+     * @tparam _Phase Clock phase
+     * @tparam _DataSize Frame size
+     */
+    template<typename _Bus,
+        typename _CsPin,
+        Private::SpiBase::ClockDivider _Divider = Private::SpiBase::Medium,
+        Private::SpiBase::ClockPolarity _Polarity = Private::SpiBase::ClockPolarityLow,
+        Private::SpiBase::ClockPhase _Phase = Private::SpiBase::ClockPhaseLeadingEdge,
+        Private::SpiBase::DataSize _DataSize = Private::SpiBase::DataSize8>
+    class SpiBusDevice
+    {
+    public:
+        using Callback = SpiBusTransaction::Callback;
+
+        /**
+         * @brief Enqueue transmit and receive transaction
+         *
+         * @param [in] transmitBuffer Data to transmit (nullptr to send 0xff)
+         * @param [out] receiveBuffer Receive buffer (nullptr to ignore)
+         * @param [in] count Frames count
+         * @param [in] callback Complete callback (optional parameter)
+         * @param [in] keepSelected Keep chip select after transaction (optional parameter)
+         *
+         * @retval true Transaction queued
+         * @retval false Queue is full
+         */
+        static bool Transfer(const void* transmitBuffer, void* receiveBuffer, uint16_t count, Callback callback = nullptr, bool keepSelected = false)
+        {
+            return _Bus::Enqueue({
+                .Select = ChipSelect,
+                .Divider = _Divider,
+                .Polarity = _Polarity,
+                .Phase = _Phase,
+                .DataSize = _DataSize,
+                .TransmitBuffer = transmitBuffer,
+                .ReceiveBuffer = receiveBuffer,
+                .Count = count,
+                .KeepSelected = keepSelected,
+                .OnComplete = callback});
+        }
+
+        /**
+         * @brief Enqueue transmit transaction
+         *
+         * @param [in] data Data to transmit
+         * @param [in] count Frames count
+         * @param [in] callback Complete callback (optional parameter)
+         * @param [in] keepSelected Keep chip select after transaction (optional parameter)
+         *
+         * @retval true Transaction queued
+         * @retval false Queue is full
+         */
+        static bool Write(const void* data, uint16_t count, Callback callback = nullptr, bool keepSelected = false)
+        {
+            return Transfer(data, nullptr, count, callback, keepSelected);
+        }
+
+        /**
+         * @brief Enqueue receive transaction (0xff is transmitted)
+         *
+         * @param [out] data Receive buffer
+         * @param [in] count Frames count
+         * @param [in] callback Complete callback (optional parameter)
+         * @param [in] keepSelected Keep chip select after transaction (optional parameter)
+         *
+         * @retval true Transaction queued
+         * @retval false Queue is full
+         */
+        static bool Read(void* data, uint16_t count, Callback callback = nullptr, bool keepSelected = false)
+        {
+            return Transfer(nullptr, data, count, callback, keepSelected);
+        }
+
+    private:
+        static void ChipSelect(bool select)
+        {
+            if(select)
+                _CsPin::Clear();
+            else
+                _CsPin::Set();
+        }
+    };
+} // namespace Zhele
+
+#include "impl/spi_bus.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_SPI_BUS_H
@@ -0,0 +1,114 @@
+/**
+ * @file
+ * Implements tickless low-power idle on top of software timer wheel
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_TICKLESS_IDLE_H
+#define ZHELE_PLATFORM_STM32_COMMON_TICKLESS_IDLE_H
+
+#include "ioreg.h"
+
+#include <zhele/clock.h>
+#include <zhele/timer_wheel.h>
+#include <zhele/common/delegate.h>
+
+#include <cstdint>
+#include <limits>
+
+namespace Zhele::Timers
+{
+    namespace Private
+    {
+        IO_STRUCT_WRAPPER(PWR, PwrRegs, PWR_TypeDef);
+        IO_STRUCT_WRAPPER(RCC, RccRegs, RCC_TypeDef);
+        IO_STRUCT_WRAPPER(SCB, ScbRegs, SCB_Type);
+    }
+
+    /**
+     * @brief Idle hook that sleeps until next deadline of timer wheel
+     *
+     * @details
+     * Call Enter from main loop (or from wait loop instead of busy-wait) when there is nothing to do.
+     * Wheel keeps its compare channel programmed to nearest expiration (\ref TimerWheel is tickless),
+     * so core sleeps (WFI) until this deadline or any other interrupt, there is no periodic tick wake-up.
+     *
+     * General-purpose timers are stopped in Stop mode, so Stop mode is used only if it is enabled
+     * and wheel has no timers: wake-up source is external (EXTI line, RTC alarm). After Stop
+     * system clock source that was used before (PLL, HSE) is selected again by \ref Clock::SysClock,
+     * bus prescalers are kept by hardware.
+     *
+     * Work check and sleep entry are done with interrupts masked (PRIMASK), so interrupt that makes
+     * work pending after check is not lost: it wakes core up and its handler runs after Enter has restored clock.
+     * Enter restores PRIMASK value it was called with, so it can be called from critical section too
+     * (pending interrupt still wakes core up, its handler runs after critical section).
+     *
+     * @par Example
+     * @code
+     * using Wheel = Timers::TimerWheel<Timers::Timer3>;
+     * using Idle = Timers::TicklessIdle<Wheel>;
+     *
+     * volatile bool complete = false;
+     * // ... start transfer that sets complete from its interrupt
+     * while(!complete)
+     *     Idle::Enter([]{ return complete; });
+     * @endcode
+     *
+     * @tparam _Wheel Timer wheel (Timers::TimerWheel)
+     */
+    template<typename _Wheel>
+    class TicklessIdle
+    {
+    public:
+        using Ticks = typename _Wheel::Ticks;
+        using WorkPending = Delegate<bool()>;
+
+        /// Idle result
+        enum class Mode : uint8_t
+        {
+            Busy,   ///< Work or expiration is pending, core did not sleep
+            Sleep,  ///< Sleep mode (core clock stopped)
+            Stop,   ///< Stop mode (all clocks stopped)
+        };
+
+        /**
+         * @brief Allow Stop mode when wheel has no timers
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void EnableStop();
+
+        /**
+         * @brief Forbid Stop mode (Sleep mode only)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void DisableStop();
+
+        /**
+         * @brief Sleep until next interrupt
+         *
+         * @param [in] workPending Work check (called with interrupts masked), nullptr if there is no work to check
+         *
+         * @returns Used mode
+         */
+        static Mode Enter(WorkPending workPending = nullptr);
+
+    private:
+        static void EnterStop();
+        static void WaitForInterrupt();
+        static uint32_t DisableInterrupts();
+        static void RestoreInterrupts(uint32_t primask);
+
+        static inline bool _stopEnabled = false;
+    };
+}
+
+#include "impl/tickless_idle.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_TICKLESS_IDLE_H
@@ -14,9 +14,12 @@
 #include "ioreg.h"
 
 #include <zhele/clock.h>
+#include <zhele/dma.h>
 #include <zhele/iopins.h>
 #include <zhele/pinlist.h>
 
+#include <cstddef>
+
 namespace Zhele::Timers
 {
     namespace Private
@@ -534,6 +537,92 @@ namespace Zhele::Timers
                 static void SetTriggerPrescaler(ExternalTriggerPrescaler prescaler);
             };
 
+            /// Timer registers available for DMA burst (register offset from CR1 in words)
+            enum class BurstRegister : uint8_t
+            {
+                CR1 = offsetof(TIM_TypeDef, CR1) / 4, ///< Control register 1
+                CR2 = offsetof(TIM_TypeDef, CR2) / 4, ///< Control register 2
+                SMCR = offsetof(TIM_TypeDef, SMCR) / 4, ///< Slave mode control register
+                DIER = offsetof(TIM_TypeDef, DIER) / 4, ///< DMA/interrupt enable register
+                EGR = offsetof(TIM_TypeDef, EGR) / 4, ///< Event generation register
+                CCMR1 = offsetof(TIM_TypeDef, CCMR1) / 4, ///< Capture/compare mode register 1
+                CCMR2 = offsetof(TIM_TypeDef, CCMR2) / 4, ///< Capture/compare mode register 2
+                CCER = offsetof(TIM_TypeDef, CCER) / 4, ///< Capture/compare enable register
+                CNT = offsetof(TIM_TypeDef, CNT) / 4, ///< Counter
+                PSC = offsetof(TIM_TypeDef, PSC) / 4, ///< Prescaler
+                ARR = offsetof(TIM_TypeDef, ARR) / 4, ///< Auto-reload register
+                RCR = offsetof(TIM_TypeDef, RCR) / 4, ///< Repetition counter (advanced timers)
+                CCR1 = offsetof(TIM_TypeDef, CCR1) / 4, ///< Capture/compare register 1
+                CCR2 = offsetof(TIM_TypeDef, CCR2) / 4, ///< Capture/compare register 2
+                CCR3 = offsetof(TIM_TypeDef, CCR3) / 4, ///< Capture/compare register 3
+                CCR4 = offsetof(TIM_TypeDef, CCR4) / 4, ///< Capture/compare register 4
+                BDTR = offsetof(TIM_TypeDef, BDTR) / 4, ///< Break and dead-time register (advanced timers)
+            };
+
+            /**
+             * @brief DMA burst transfer (DCR/DMAR registers)
+             *
+             * @details
+             * Each update event requests burst of DMA transfers to DMAR register, timer redirects them
+             * to consecutive registers starting with base one. So table of register values
+             * (one row of length items per timer period) is played out without CPU:
+             * waveforms (WS2812, DShot), multi-channel PWM sequences and period/duty pairs.
+             * Values written to preloaded registers (ARR with ARPE, CCRx with OCxPE) take effect
+             * on the next update event.
+             *
+             * DMA channel must be connected to timer update request (TIMx_UP): it is fixed channel
+             * on F0/F1, channel select parameter on F4/L4 and DMAMUX request (see DmaMux) on G0/C0.
+             * Transfer callback of DMA channel (SetTransferCallback) is called after the last burst
+             * (after each pass of table in circular mode).
+             *
+             * @par Example
+             * @code
+             * using Burst = Timers::Timer3::DmaBurst<Dma1Channel3>;
+             * // Duty of channels 1..4 for 3 periods
+             * static const uint16_t duty[3][4] = {{10, 20, 30, 40}, {20, 30, 40, 50}, {0, 0, 0, 0}};
+             * Burst::Start(Timers::Timer3::BurstRegister::CCR1, 4, &duty[0][0], 3);
+             * @endcode
+             *
+             * @tparam _DmaChannel DMA channel (stream) connected to timer update request
+             */
+            template<typename _DmaChannel>
+            class DmaBurst
+            {
+            public:
+                /**
+                 * @brief Configure burst and start DMA transfer of table
+                 *
+                 * @param [in] base First register of burst
+                 * @param [in] length Registers count per burst (1..18)
+                 * @param [in] table Register values, bursts * length items (uint16_t or uint32_t for 32-bit timers)
+                 * @param [in] bursts Bursts (update events) count
+                 * @param [in] circular Restart table after last burst
+                 * @param [in] channel DMA channel (for DMA with streams)
+                 *
+                 * @retval true Transfer is started
+                 * @retval false Length is out of range or table has more than 65535 items (DMA counter limit)
+                 */
+                template<typename _Data>
+                static bool Start(BurstRegister base, uint8_t length, const _Data* table, uint16_t bursts, bool circular = false
+                ONLY_IF_STREAM_SUPPORTED(COMMA uint8_t channel = 0));
+
+                /**
+                 * @brief Stop burst transfer
+                 *
+                 * @par Returns
+                 *  Nothing
+                 */
+                static void Stop();
+
+                /**
+                 * @brief Check that all bursts are transferred (not circular transfer)
+                 *
+                 * @retval true Table has been played out
+                 * @retval false Transfer is in progress
+                 */
+                static bool Done();
+            };
+
             /**
              * @brief Internal class for input capture feature
              *
@@ -618,6 +707,65 @@ namespace Zhele::Timers
                  */
                 template<typename Pin>
                 static void SelectPins();
+
+                /**
+                 * @brief Capture to circular buffer by DMA
+                 *
+                 * @details
+                 * Each capture requests DMA transfer of capture register, so edge timestamps
+                 * (or intervals, if counter is reset by edge in slave reset mode) are recorded without CPU.
+                 * Buffer is written in circular mode, so reader takes new values from its last position
+                 * up to \ref Position (outside of interrupt). Frequency is measured by this way without interrupts.
+                 *
+                 * DMA channel must be connected to capture request of channel (TIMx_CHy): it is fixed channel
+                 * on F0/F1, channel select parameter on F4/L4 and DMAMUX request (see DmaMux) on G0/C0.
+                 *
+                 * @par Example
+                 * @code
+                 * using Capture = Timers::Timer3::InputCapture<0>::DmaCapture<Dma1Channel6>;
+                 * static uint16_t edges[64];
+                 * Capture::Start(edges, 64);
+                 * // ...
+                 * uint16_t last = (Capture::Position() + 63) % 64;
+                 * uint16_t period = edges[last] - edges[(last + 63) % 64]; // ticks between last two edges
+                 * @endcode
+                 *
+                 * @tparam _DmaChannel DMA channel (stream) connected to capture request
+                 */
+                template<typename _DmaChannel>
+                class DmaCapture
+                {
+                public:
+                    /**
+                     * @brief Start capture to circular buffer
+                     *
+                     * @param [out] buffer Buffer for captured values
+                     * @param [in] size Buffer size (items)
+                     * @param [in] channel DMA channel (for DMA with streams)
+                     *
+                     * @par Returns
+                     *  Nothing
+                     */
+                    static void Start(typename Base::Counter* buffer, uint16_t size ONLY_IF_STREAM_SUPPORTED(COMMA uint8_t channel = 0));
+
+                    /**
+                     * @brief Stop capture transfer
+                     *
+                     * @par Returns
+                     *  Nothing
+                     */
+                    static void Stop();
+
+                    /**
+                     * @brief Returns index of buffer item for next captured value
+                     *
+                     * @returns Write position (0..size-1)
+                     */
+                    static uint16_t Position();
+
+                private:
+                    static inline uint16_t _size = 0;
+                };
             };
 
             /**
@@ -0,0 +1,240 @@
+/**
+ * @file
+ * Implements hierarchical software timer wheel on hardware timer compare channel
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_TIMER_WHEEL_H
+#define ZHELE_PLATFORM_STM32_COMMON_TIMER_WHEEL_H
+
+#include <zhele/common/delegate.h>
+#include <zhele/timer.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace Zhele::Timers
+{
+    template<typename _Timer, unsigned _Channel, unsigned _SlotBits, unsigned _Levels>
+    class TimerWheel;
+
+    /**
+     * @brief Software timer (node of \ref TimerWheel)
+     *
+     * @details
+     * Timer is intrusive list node, wheel does not allocate memory and does not copy timers,
+     * so started timer must outlive its schedule (static or global object).
+     */
+    class SoftTimer
+    {
+        template<typename, unsigned, unsigned, unsigned>
+        friend class TimerWheel;
+
+    public:
+        using Callback = Delegate<void()>;
+
+        /**
+         * @brief Constructor
+         *
+         * @param [in] callback Expiration callback (called from timer interrupt)
+         */
+        constexpr SoftTimer(Callback callback = nullptr)
+            : _callback(callback)
+        {}
+
+        SoftTimer(const SoftTimer&) = delete;
+        SoftTimer& operator=(const SoftTimer&) = delete;
+
+        /**
+         * @brief Set expiration callback
+         *
+         * @param [in] callback Expiration callback (called from timer interrupt)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        void SetCallback(Callback callback)
+        {
+            _callback = callback;
+        }
+
+        /**
+         * @brief Check that timer is scheduled
+         *
+         * @retval true Timer is scheduled
+         * @retval false Timer is stopped (or one-shot timer has expired)
+         */
+        bool IsActive() const
+        {
+            return _pprev != nullptr;
+        }
+
+        /**
+         * @brief Returns expiration time of scheduled timer
+         *
+         * @returns Expiration time (wheel ticks)
+         */
+        uint32_t Expiry() const
+        {
+            return _expiry;
+        }
+
+    private:
+        SoftTimer* _next = nullptr;
+        SoftTimer** _pprev = nullptr;
+        uint32_t _expiry = 0;
+        uint32_t _period = 0;
+        uint16_t _slot = 0;
+        Callback _callback;
+    };
+
+    /**
+     * @brief Hierarchical timer wheel
+     *
+     * @details
+     * Wheel keeps any number of software timers on one compare channel of general-purpose timer.
+     * Hardware timer counts freely (period 0xffff), compare channel is programmed to nearest
+     * expiration (tickless), so there is no periodic tick interrupt: interrupt occurs on expiration
+     * or at least once per half of counter period.
+     *
+     * Each level has 2^_SlotBits slots, slot of level N covers 2^(_SlotBits * N) ticks. Timer is stored
+     * on the finest level which slot differs from current time only in this level digit, so start and cancel
+     * are O(1) (list insert/unlink, occupancy bit and compare update if timer is the nearest one).
+     * Nearest slot is found by bit scan of occupancy mask per level, timers of coarse slot are moved
+     * to finer level when wheel time reaches this slot (in interrupt of next expiration).
+     *
+     * Callbacks are called from timer interrupt, they may start and cancel timers (including itself).
+     * Start and cancel from thread context mask compare interrupt for a few instructions, they must not
+     * be called from interrupts with higher priority than timer interrupt.
+     *
+     * @par Example
+     * @code
+     * using Wheel = Timers::TimerWheel<Timers::Timer3>;
+     * Timers::SoftTimer blink([]{ IO::Pc13::Toggle(); });
+     *
+     * extern "C" void TIM3_IRQHandler() { Wheel::IRQHandler(); }
+     *
+     * Wheel::Init(1000); // 1 ms tick
+     * Wheel::Start(blink, 500, 500);
+     * @endcode
+     *
+     * @tparam _Timer General-purpose timer (Timers::TimerN)
+     * @tparam _Channel Compare channel number (0..3)
+     * @tparam _SlotBits Bits of slot index (slots count per level is 2^_SlotBits)
+     * @tparam _Levels Levels count
+     */
+    template<typename _Timer, unsigned _Channel = 0, unsigned _SlotBits = 6, unsigned _Levels = 4>
+    class TimerWheel
+    {
+        static_assert(_SlotBits >= 2 && _SlotBits <= 6, "Slots count should be from 4 to 64");
+        static_assert(_Levels >= 1 && _SlotBits * _Levels <= 32, "Wheel range should fit 32-bit ticks");
+
+        using Compare = typename _Timer::template OutputCompare<_Channel>;
+        using Counter = typename _Timer::Counter;
+        using SlotMask = std::conditional_t<(_SlotBits > 5), uint64_t, uint32_t>;
+
+        static constexpr unsigned SlotsCount = 1u << _SlotBits;
+        static constexpr SlotMask AllSlots = SlotMask(~SlotMask(0)) >> (std::numeric_limits<SlotMask>::digits - SlotsCount);
+        static constexpr unsigned TopShift = _SlotBits * (_Levels - 1);
+        static constexpr uint32_t CounterPeriod = std::numeric_limits<Counter>::max() + 1u;
+        static constexpr uint32_t MaxCompareDelay = CounterPeriod / 2;
+
+    public:
+        using Ticks = uint32_t;
+
+        /**
+         * @brief Max delay and period of timer
+         *
+         * @details
+         * Top level slot index must not reach current slot, margin of one counter period
+         * covers wheel time lag (expired but not processed ticks).
+         */
+        static constexpr Ticks MaxDelay = Ticks(SlotsCount - 2) * (Ticks(1) << TopShift) - CounterPeriod;
+        static_assert(Ticks(SlotsCount - 2) * (Ticks(1) << TopShift) > CounterPeriod, "Wheel range should exceed hardware counter period");
+
+        /**
+         * @brief Configures hardware timer and starts wheel
+         *
+         * @param [in] tickFrequency Wheel tick frequency (Hz), timer clock / tickFrequency should fit prescaler
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Init(unsigned tickFrequency);
+
+        /**
+         * @brief Returns current wheel time
+         *
+         * @returns Ticks since Init (modulo 2^32)
+         */
+        static Ticks Now();
+
+        /**
+         * @brief Start (or restart) timer
+         *
+         * @param [in, out] timer Timer
+         * @param [in] delay Delay before first expiration (limited by \ref MaxDelay)
+         * @param [in] period Period of next expirations (limited by \ref MaxDelay), zero for one-shot timer
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Start(SoftTimer& timer, Ticks delay, Ticks period = 0);
+
+        /**
+         * @brief Stop timer (does nothing for stopped timer)
+         *
+         * @param [in, out] timer Timer
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Cancel(SoftTimer& timer);
+
+        /**
+         * @brief Returns ticks to nearest expiration
+         *
+         * @returns Ticks from current time, zero if expiration is pending, max value if wheel is empty
+         */
+        static Ticks NextExpiryDelay();
+
+        /**
+         * @brief Compare interrupt handler
+         *
+         * @details
+         * Call it from timer IRQ handler.
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void IRQHandler();
+
+    private:
+        static Ticks CounterElapsed(Counter counter);
+        static unsigned NextSlot(unsigned level);
+        static Ticks NextEvent(unsigned& level);
+        static Ticks NextExpiry();
+        static void Insert(SoftTimer& timer);
+        static void Remove(SoftTimer& timer);
+        static void Advance(Ticks to);
+        static void Expire(SoftTimer& timer, Ticks now);
+        static void Schedule(Ticks distance);
+        static void Lock();
+        static void Unlock();
+
+        static inline SoftTimer* _slots[_Levels * SlotsCount] {};
+        static inline SlotMask _occupied[_Levels] {};
+        static inline Ticks _now = 0;
+        static inline Ticks _wakeup = 0;
+        static inline Counter _counter = 0;
+        static inline bool _inHandler = false;
+    };
+}
+
+#include "impl/timer_wheel.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_TIMER_WHEEL_H
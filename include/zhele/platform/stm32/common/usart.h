@@ -288,6 +288,18 @@ namespace Zhele
              * 	Nothing
              */
             static void EnableAsyncRead(void* receiveBuffer, size_t bufferSize, TransferCallback callback = nullptr);
+
+            /**
+             * @brief Enable async read (by DMA) to descriptor list (scattered read)
+             * 
+             * @param [in] descriptors Descriptor list (buffers are written)
+             * @param [in] count Descriptors count
+             * @param [in] callback Transfer complete callback (optional parameter)
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void EnableAsyncReadList(const DmaReceiveDescriptor* descriptors, uint16_t count, TransferCallback callback = nullptr);
            
 
             /**
@@ -334,6 +346,18 @@ namespace Zhele
              */
             static void WriteAsync(const void* data, size_t size, TransferCallback callback = nullptr);
 
+            /**
+             * @brief Write descriptor list to USART async (gathered write via DMA)
+             * 
+             * @param [in] descriptors Descriptor list
+             * @param [in] count Descriptors count
+             * @param [in] callback Transfer complete callback
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void WriteAsyncList(const DmaDescriptor* descriptors, uint16_t count, TransferCallback callback = nullptr);
+
             /**
              * @brief Synch write byte
              * 
@@ -0,0 +1,272 @@
+/**
+ * @file
+ * Implements USART receive stream (circular DMA) and transmit queue
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_COMMON_USART_STREAM_H
+#define ZHELE_PLATFORM_STM32_COMMON_USART_STREAM_H
+
+#include <zhele/usart.h>
+#include <zhele/containers/spsc_ring_buffer.h>
+
+#include <span>
+#include <type_traits>
+
+namespace Zhele
+{
+    /**
+     * @brief USART receive stream
+     *
+     * @details
+     * RX DMA works in circular mode over stream buffer, so there is no per-byte interrupts and
+     * no gaps between transfers. New data is published on DMA half-transfer and transfer-complete
+     * events and on USART idle line (or receiver timeout) event: stream reads DMA remaining transfers
+     * counter and moves write position. Consumer reads data by Read or by ReadRegion/Consume
+     * (without copy).
+     *
+     * DMA and USART interrupt handlers must call DmaIrqHandler and UsartIrqHandler
+     * (instead of DmaRx::IrqHandler). Both interrupts must have same priority.
+     *
+     * @par Example
+     * @code
+     * using Stream = UsartRxStream<Usart1, 256>;
+     * extern "C" void DMA1_Channel5_IRQHandler() { Stream::DmaIrqHandler(); }
+     * extern "C" void USART1_IRQHandler() { Stream::UsartIrqHandler(); }
+     *
+     * Stream::Start();
+     * ...
+     * uint8_t data[32];
+     * size_t count = Stream::Read(data, sizeof(data));
+     * @endcode
+     *
+     * @tparam _Usart USART (with RX DMA)
+     * @tparam _Size Stream buffer size (data received while consumer is late is lost
+     * if buffer overruns, see Overrun)
+     */
+    template<typename _Usart, unsigned _Size>
+    class UsartRxStream
+    {
+        using DmaRx = typename _Usart::DmaRx;
+        static_assert(!std::is_same_v<DmaRx, void>, "USART has no RX DMA");
+        static_assert(_Size >= 2);
+    public:
+        /// Data callback, called from interrupt with count of available bytes
+        using DataCallback = Delegate<void(size_t available)>;
+
+        /**
+         * @brief Start receiving
+         *
+         * @details
+         * USART must be initialized. Previous stream content is dropped.
+         *
+         * @param [in] callback New data callback (optional parameter)
+         * @param [in] receiverTimeout Receiver timeout in bits. Enables receiver timeout event
+         * (on USART with RTOR) in addition to idle line event. Zero disables timeout (default)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Start(DataCallback callback = nullptr, uint32_t receiverTimeout = 0);
+
+        /**
+         * @brief Stop receiving
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Stop();
+
+        /**
+         * @brief Returns count of received and not read bytes
+         *
+         * @returns Available bytes count
+         */
+        static size_t Available();
+
+        /**
+         * @brief Read received data
+         *
+         * @param [out] data Destination
+         * @param [in] size Destination size
+         *
+         * @returns Count of read bytes
+         */
+        static size_t Read(void* data, size_t size);
+
+        /**
+         * @brief Returns largest contiguous block of received data
+         *
+         * @details
+         * Process returned block and call Consume.
+         *
+         * @returns Received data (empty if there is no data)
+         */
+        static std::span<const uint8_t> ReadRegion();
+
+        /**
+         * @brief Release read data
+         *
+         * @param [in] count Bytes count (not greater than available)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Consume(size_t count);
+
+        /**
+         * @brief Returns and clears overrun state
+         *
+         * @details
+         * Overrun is detected when DMA overwrites data that was not read.
+         * On overrun all available data is dropped.
+         *
+         * @retval true Overrun was occured
+         * @retval false No overrun
+         */
+        static bool Overrun();
+
+        /**
+         * @brief Publish data received so far (without waiting for DMA or USART event)
+         *
+         * @details
+         * Can be called from interrupt with same priority as DMA and USART interrupts
+         * (timer, for example).
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Publish();
+
+        /**
+         * @brief RX DMA interrupt handler (half-transfer and transfer-complete events)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void DmaIrqHandler();
+
+        /**
+         * @brief USART interrupt handler (idle line and receiver timeout events)
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void UsartIrqHandler();
+
+    private:
+        static inline uint8_t _buffer[_Size];
+        static inline DataCallback _callback = nullptr;
+
+        static inline uint32_t _position = 0; ///< Last DMA position (producer)
+        static inline volatile uint32_t _published = 0; ///< Received bytes total (producer)
+        static inline volatile uint32_t _consumed = 0; ///< Read bytes total (consumer)
+        static inline uint32_t _readOffset = 0; ///< Read position in buffer (consumer)
+        static inline volatile bool _overrun = false;
+    };
+
+    /**
+     * @brief USART transmit queue
+     *
+     * @details
+     * Write copies data to queue and returns immediately. TX DMA sends queue content
+     * by contiguous chunks: transfer complete callback starts next chunk until queue drains.
+     * If there is no enough space in queue, Write accepts only part of data (back-pressure),
+     * rejected bytes are counted.
+     *
+     * Queue uses TX DMA transfer callback, so DMA interrupt handler must call DmaTx::IrqHandler
+     * (as for Usart::WriteAsync). Do not use Usart::Write/WriteAsync while queue is not empty.
+     * Write must be called from one context (thread or interrupt).
+     *
+     * @par Example
+     * @code
+     * using TxQueue = UsartTxQueue<Usart1, 512>;
+     * extern "C" void DMA1_Channel4_IRQHandler() { Usart1::DmaTx::IrqHandler(); }
+     *
+     * if(TxQueue::Write(line, length) != length)
+     *     ++lostLines;
+     * @endcode
+     *
+     * @tparam _Usart USART (with TX DMA)
+     * @tparam _Size Queue size
+     */
+    template<typename _Usart, unsigned _Size>
+    class UsartTxQueue
+    {
+        using DmaTx = typename _Usart::DmaTx;
+        static_assert(!std::is_same_v<DmaTx, void>, "USART has no TX DMA");
+    public:
+        /**
+         * @brief Queue data
+         *
+         * @param [in] data Data
+         * @param [in] size Data size
+         *
+         * @returns Count of queued bytes (less than size if queue is full)
+         */
+        static size_t Write(const void* data, size_t size);
+
+        /**
+         * @brief Queue byte
+         *
+         * @param [in] data Byte
+         *
+         * @retval true Byte queued
+         * @retval false Queue is full
+         */
+        static bool Write(uint8_t data);
+
+        /**
+         * @brief Returns free space in queue
+         *
+         * @returns Count of bytes that can be queued
+         */
+        static size_t FreeSpace();
+
+        /**
+         * @brief Returns count of bytes waiting for transmit (including current DMA chunk)
+         *
+         * @returns Queued bytes count
+         */
+        static size_t Pending();
+
+        /**
+         * @brief Check that queue is drained and DMA is idle
+         *
+         * @retval true All data passed to USART
+         * @retval false Transmit in progress
+         */
+        static bool Idle();
+
+        /**
+         * @brief Returns and clears count of bytes rejected because of full queue
+         *
+         * @returns Rejected bytes count
+         */
+        static uint32_t Rejected();
+
+        /**
+         * @brief Wait until queue drains
+         *
+         * @par Returns
+         *	Nothing
+         */
+        static void Flush();
+
+    private:
+        static void StartNext();
+        static void TransferCompleted(void* data, unsigned size, bool success);
+
+        static inline Containers::SpscRingBuffer<_Size, uint8_t> _queue;
+        static inline volatile size_t _chunk = 0;
+        static inline volatile bool _busy = false;
+        static inline uint32_t _rejected = 0;
+    };
+} // namespace Zhele
+
+#include "impl/usart_stream.h"
+
+#endif //! ZHELE_PLATFORM_STM32_COMMON_USART_STREAM_H
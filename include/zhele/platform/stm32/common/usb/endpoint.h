@@ -17,6 +17,7 @@
 #ifndef ZHELE_PLATFORM_STM32_COMMON_USB_ENDPOINT_H
 #define ZHELE_PLATFORM_STM32_COMMON_USB_ENDPOINT_H
 
+#include <zhele/common/delegate.h>
 #include <zhele/common/template_utils/type_list.h>
 
 #include "common.h"
@@ -422,10 +423,8 @@ namespace Zhele::Usb
         }
     };
 
-    // Using std::function allows lambdas as callbacks, but takes ~1,2Kb flash and ~100 bytes RAM
-    // Please advise me best solution
-    //using InTransferCallback = std::function<void()>;
-    using InTransferCallback = std::add_pointer_t<void()>;
+    // Delegate allows stateful callbacks (object + method) at function pointer cost (std::function takes ~1,2Kb flash and ~100 bytes RAM)
+    using InTransferCallback = Delegate<void()>;
 
     /**
      * @brief Endpoint with TX feature
@@ -502,7 +501,7 @@ namespace Zhele::Usb
     template<typename _Base, typename _Reg, uint32_t _BufferAddress, uint32_t _CountRegAddress>
     InTransferCallback EndpointWithTxSupport<_Base, _Reg, _BufferAddress, _CountRegAddress>::_txCompleteCallback = nullptr;
 
-    using OutTransferCallback = std::add_pointer_t<void()>;
+    using OutTransferCallback = Delegate<void()>;
     /**
      * @brief Endpoint with RX feature
      */
@@ -956,7 +955,7 @@ namespace Zhele::Usb
                     : 0b00;
     }
 
-    using OutTransferCallback = std::add_pointer_t<void()>;
+    using OutTransferCallback = Delegate<void()>;
     /**
      * @brief Implements out (RX) endpoint
      * 
@@ -1132,7 +1131,7 @@ namespace Zhele::Usb
     template<typename _Base, typename _Regs, uint32_t _FifoAddress>
     uint8_t OutEndpoint<_Base, _Regs, _FifoAddress>::Buffer[_Base::MaxPacketSize] = {};
 
-    using InTransferCallback = std::add_pointer_t<void()>;
+    using InTransferCallback = Delegate<void()>;
     /**
      * @brief Implements in (TX) endpoint
      * 
@@ -0,0 +1,30 @@
+/**
+ * @file
+ * STM32: core cycle counter (DWT or SysTick of Cortex-M core — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_CYCLE_COUNTER_H
+#define ZHELE_PLATFORM_STM32_CYCLE_COUNTER_H
+
+#if defined(STM32C0)
+    #include <stm32c0xx.h>
+#endif
+#if defined(STM32F0)
+    #include <stm32f0xx.h>
+#endif
+#if defined(STM32F1)
+    #include <stm32f1xx.h>
+#endif
+#if defined(STM32F4)
+    #include <stm32f4xx.h>
+#endif
+#if defined(STM32L4)
+    #include <stm32l4xx.h>
+#endif
+#if defined(STM32G0)
+    #include <stm32g0xx.h>
+#endif
+
+#include "common/cycle_counter.h"
+
+#endif // ZHELE_PLATFORM_STM32_CYCLE_COUNTER_H
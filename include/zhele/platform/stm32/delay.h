@@ -1,32 +1,11 @@
 /**
  * @file
- * United header for delay
- * 
- * @author Alexey Zhelonkin
- * @date 2019
- * @license MIT
+ * STM32: delay (core cycle counter — no family split needed)
  */
 
 #ifndef ZHELE_PLATFORM_STM32_DELAY_H
 #define ZHELE_PLATFORM_STM32_DELAY_H
 
-#if defined(STM32C0)
-    #include "c0/delay.h"
-#endif
-#if defined(STM32F0)
-    #include "f0/delay.h"
-#endif
-#if defined(STM32F1)
-    #include "f1/delay.h"
-#endif
-#if defined(STM32F4)
-    #include "f4/delay.h"
-#endif
-#if defined(STM32L4)
-    #include "l4/delay.h"
-#endif
-#if defined(STM32G0)
-    #include "g0/delay.h"
-#endif
+#include "common/delay.h"
 
 #endif // ZHELE_PLATFORM_STM32_DELAY_H
@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: compile-time DMA channel allocator (built on DMA channel and DMAMUX — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_DMA_ALLOCATOR_H
+#define ZHELE_PLATFORM_STM32_DMA_ALLOCATOR_H
+
+#include "common/dma_allocator.h"
+
+#endif // ZHELE_PLATFORM_STM32_DMA_ALLOCATOR_H
@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: DMA memory copy/fill service (built on DMA channel — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_DMA_MEMORY_H
+#define ZHELE_PLATFORM_STM32_DMA_MEMORY_H
+
+#include "common/dma_memory.h"
+
+#endif // ZHELE_PLATFORM_STM32_DMA_MEMORY_H
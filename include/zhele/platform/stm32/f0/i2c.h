@@ -93,6 +93,16 @@ namespace Zhele
         };
 
         IO_STRUCT_WRAPPER(I2C1, I2C1Regs, I2C_TypeDef);
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::EnableFastModePlus()
+        {
+            Clock::SysCfgCompClock::Enable();
+        #if defined (SYSCFG_CFGR1_I2C_FMP_I2C1)
+            if constexpr (std::is_same_v<_Regs, I2C1Regs>)
+                SYSCFG->CFGR1 |= SYSCFG_CFGR1_I2C_FMP_I2C1;
+        #endif
+        }
     }
     using I2c1 = Private::I2cBase<Private::I2C1Regs, I2C1_IRQn, I2C1_IRQn, Clock::I2c1Clock, Private::I2C1SclPins, Private::I2C1SdaPins, Dma1Channel2, Dma1Channel3>;
 }
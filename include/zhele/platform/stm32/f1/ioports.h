@@ -380,7 +380,9 @@ namespace Zhele
             template<typename _Regs, typename _ClkEnReg, uint8_t ID>
             class PortImplementation : public NativePortBase
             {
-            public:                
+            public:
+                using Regs = _Regs;
+
                 /**
                  * @brief Read output port value
                  * @details
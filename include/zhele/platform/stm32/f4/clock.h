@@ -235,6 +235,7 @@ namespace Zhele::Clock
     using I2c1Clock = ClockControl<PeriphClockEnable1, RCC_APB1ENR_I2C1EN, Apb1Clock>;
     using I2c2Clock = ClockControl<PeriphClockEnable1, RCC_APB1ENR_I2C2EN, Apb1Clock>;
     using PwrClock = ClockControl<PeriphClockEnable1, RCC_APB1ENR_PWREN, Apb1Clock>;
+    using PowerClock = PwrClock; ///< Same name as other families have
     using Tim5Clock = ClockControl<PeriphClockEnable1, RCC_APB1ENR_TIM5EN, Apb1Clock>;
     using Usart2Clock = ClockControl<PeriphClockEnable1, RCC_APB1ENR_USART2EN, Apb1Clock>;
     using WatchDogClock = ClockControl<PeriphClockEnable1, RCC_APB1ENR_WWDGEN, Apb1Clock>;
@@ -46,6 +46,17 @@ namespace Zhele
             {
                 _DmaStream::Transfer(mode, buffer, periph, bufferSize, _DmaChannel);
             }
+
+            template<typename _Buffer>
+            static void TransferList(DmaBase::Mode mode, const BasicDmaDescriptor<_Buffer>* descriptors, uint16_t count, volatile void* periph)
+            {
+                _DmaStream::TransferList(mode, descriptors, count, periph, _DmaChannel);
+            }
+
+            static void TransferDoubleBuffer(DmaBase::Mode mode, void* buffer0, void* buffer1, volatile void* periph, uint16_t bufferSize)
+            {
+                _DmaStream::TransferDoubleBuffer(mode, buffer0, buffer1, periph, bufferSize, _DmaChannel);
+            }
         };
     }        
 
@@ -247,6 +247,7 @@ namespace Zhele::Clock
     using I2c1Clock = ClockControl<PeriphClockEnable11, RCC_APB1ENR1_I2C1EN, Apb1Clock>;
     using I2c3Clock = ClockControl<PeriphClockEnable11, RCC_APB1ENR1_I2C3EN, Apb1Clock>;
     using PwrClock = ClockControl<PeriphClockEnable11, RCC_APB1ENR1_PWREN, Apb1Clock>;
+    using PowerClock = PwrClock; ///< Same name as other families have
     using OpampClock = ClockControl<PeriphClockEnable11, RCC_APB1ENR1_OPAMPEN, Apb1Clock>;
     using LPTim1Clock = ClockControl<PeriphClockEnable11, RCC_APB1ENR1_LPTIM1EN, Apb1Clock>;
     using LpUart1Clock = ClockControl<PeriphClockEnable12, RCC_APB1ENR2_LPUART1EN, Apb1Clock>;
@@ -44,6 +44,12 @@ namespace Zhele
             {
                 _DmaStream::Transfer(mode, buffer, periph, bufferSize, _DmaChannel);
             }
+
+            template<typename _Buffer>
+            static void TransferList(DmaBase::Mode mode, const BasicDmaDescriptor<_Buffer>* descriptors, uint16_t count, volatile void* periph)
+            {
+                _DmaStream::TransferList(mode, descriptors, count, periph, _DmaChannel);
+            }
         };
     }        
 
@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: monotonic clock (compare channel of general-purpose timer — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_MONOTONIC_CLOCK_H
+#define ZHELE_PLATFORM_STM32_MONOTONIC_CLOCK_H
+
+#include "common/monotonic_clock.h"
+
+#endif // ZHELE_PLATFORM_STM32_MONOTONIC_CLOCK_H
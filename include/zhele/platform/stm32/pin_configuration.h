@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: GPIO configuration aggregator (CRL/CRH and MODER layouts in one header — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_PIN_CONFIGURATION_H
+#define ZHELE_PLATFORM_STM32_PIN_CONFIGURATION_H
+
+#include "common/pin_configuration.h"
+
+#endif // ZHELE_PLATFORM_STM32_PIN_CONFIGURATION_H
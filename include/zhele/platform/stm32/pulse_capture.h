@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: pulse train capture (general-purpose timer slave reset mode and DMA — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_PULSE_CAPTURE_H
+#define ZHELE_PLATFORM_STM32_PULSE_CAPTURE_H
+
+#include "common/pulse_capture.h"
+
+#endif // ZHELE_PLATFORM_STM32_PULSE_CAPTURE_H
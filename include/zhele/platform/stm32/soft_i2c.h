@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: software (bit-banged) I2C (only needs GPIO + cycle counter — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_SOFT_I2C_H
+#define ZHELE_PLATFORM_STM32_SOFT_I2C_H
+
+#include "common/soft_i2c.h"
+
+#endif // ZHELE_PLATFORM_STM32_SOFT_I2C_H
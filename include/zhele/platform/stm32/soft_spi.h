@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: software (bit-banged) SPI (only needs GPIO + cycle counter — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_SOFT_SPI_H
+#define ZHELE_PLATFORM_STM32_SOFT_SPI_H
+
+#include "common/soft_spi.h"
+
+#endif // ZHELE_PLATFORM_STM32_SOFT_SPI_H
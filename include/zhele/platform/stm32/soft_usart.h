@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: software (bit-banged) USART (only needs GPIO + cycle counter — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_SOFT_USART_H
+#define ZHELE_PLATFORM_STM32_SOFT_USART_H
+
+#include "common/soft_usart.h"
+
+#endif // ZHELE_PLATFORM_STM32_SOFT_USART_H
@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: SPI bus transaction queue (built on SPI and DMA — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_SPI_BUS_H
+#define ZHELE_PLATFORM_STM32_SPI_BUS_H
+
+#include "common/spi_bus.h"
+
+#endif // ZHELE_PLATFORM_STM32_SPI_BUS_H
@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: tickless idle (PWR low-power modes differ by register bits only — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_TICKLESS_IDLE_H
+#define ZHELE_PLATFORM_STM32_TICKLESS_IDLE_H
+
+#include "common/tickless_idle.h"
+
+#endif // ZHELE_PLATFORM_STM32_TICKLESS_IDLE_H
@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: software timer wheel (compare channel of general-purpose timer — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_TIMER_WHEEL_H
+#define ZHELE_PLATFORM_STM32_TIMER_WHEEL_H
+
+#include "common/timer_wheel.h"
+
+#endif // ZHELE_PLATFORM_STM32_TIMER_WHEEL_H
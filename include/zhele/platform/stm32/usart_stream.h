@@ -0,0 +1,11 @@
+/**
+ * @file
+ * STM32: USART receive stream and transmit queue (built on USART and DMA — no family split needed)
+ */
+
+#ifndef ZHELE_PLATFORM_STM32_USART_STREAM_H
+#define ZHELE_PLATFORM_STM32_USART_STREAM_H
+
+#include "common/usart_stream.h"
+
+#endif // ZHELE_PLATFORM_STM32_USART_STREAM_H
@@ -0,0 +1,20 @@
+/**
+ * @file
+ * United header for pulse train capture
+ *
+ * @author Alexey Zhelonkin
+ * @license MIT
+ */
+
+#ifndef ZHELE_PULSE_CAPTURE_H
+#define ZHELE_PULSE_CAPTURE_H
+
+#include "platform_detector.h"
+
+#if defined(ZHELE_PLATFORM_STM32)
+  #include "platform/stm32/pulse_capture.h"
+#else
+  #error "Zhele: unsupported platform. Define ZHELE_PLATFORM_XX or include CMSIS device headers."
+#endif
+
+#endif // ZHELE_PULSE_CAPTURE_H
@@ -0,0 +1,20 @@
+/**
+ * @file
+ * United header for software (bit-banged) I2C
+ *
+ * @author Alexey Zhelonkin
+ * @license MIT
+ */
+
+#ifndef ZHELE_SOFT_I2C_H
+#define ZHELE_SOFT_I2C_H
+
+#include "platform_detector.h"
+
+#if defined(ZHELE_PLATFORM_STM32)
+  #include "platform/stm32/soft_i2c.h"
+#else
+  #error "Zhele: unsupported platform. Define ZHELE_PLATFORM_XX or include CMSIS device headers."
+#endif
+
+#endif // ZHELE_SOFT_I2C_H
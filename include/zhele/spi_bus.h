@@ -0,0 +1,20 @@
+/**
+ * @file
+ * United header for SPI bus transaction queue
+ *
+ * @author Alexey Zhelonkin
+ * @license MIT
+ */
+
+#ifndef ZHELE_SPI_BUS_H
+#define ZHELE_SPI_BUS_H
+
+#include "platform_detector.h"
+
+#if defined(ZHELE_PLATFORM_STM32)
+  #include "platform/stm32/spi_bus.h"
+#else
+  #error "Zhele: unsupported platform. Define ZHELE_PLATFORM_XX or include CMSIS device headers."
+#endif
+
+#endif // ZHELE_SPI_BUS_H
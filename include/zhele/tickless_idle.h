@@ -0,0 +1,20 @@
+/**
+ * @file
+ * United header for tickless low-power idle
+ *
+ * @author Alexey Zhelonkin
+ * @license MIT
+ */
+
+#ifndef ZHELE_TICKLESS_IDLE_H
+#define ZHELE_TICKLESS_IDLE_H
+
+#include "platform_detector.h"
+
+#if defined(ZHELE_PLATFORM_STM32)
+  #include "platform/stm32/tickless_idle.h"
+#else
+  #error "Zhele: unsupported platform. Define ZHELE_PLATFORM_XX or include CMSIS device headers."
+#endif
+
+#endif // ZHELE_TICKLESS_IDLE_H
@@ -0,0 +1,20 @@
+/**
+ * @file
+ * United header for software timer wheel
+ *
+ * @author Alexey Zhelonkin
+ * @license MIT
+ */
+
+#ifndef ZHELE_TIMER_WHEEL_H
+#define ZHELE_TIMER_WHEEL_H
+
+#include "platform_detector.h"
+
+#if defined(ZHELE_PLATFORM_STM32)
+  #include "platform/stm32/timer_wheel.h"
+#else
+  #error "Zhele: unsupported platform. Define ZHELE_PLATFORM_XX or include CMSIS device headers."
+#endif
+
+#endif // ZHELE_TIMER_WHEEL_H
@@ -0,0 +1,20 @@
+/**
+ * @file
+ * United header for USART receive stream and transmit queue
+ *
+ * @author Alexey Zhelonkin
+ * @license MIT
+ */
+
+#ifndef ZHELE_USART_STREAM_H
+#define ZHELE_USART_STREAM_H
+
+#include "platform_detector.h"
+
+#if defined(ZHELE_PLATFORM_STM32)
+  #include "platform/stm32/usart_stream.h"
+#else
+  #error "Zhele: unsupported platform. Define ZHELE_PLATFORM_XX or include CMSIS device headers."
+#endif
+
+#endif // ZHELE_USART_STREAM_H
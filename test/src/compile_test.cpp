@@ -31,19 +31,18 @@ void ClockCompileTest()
     Clock::HsiClock::Enable();   
     Clock::HsiClock::Disable();
 
-    Clock::PllClock::SetClockFreq(ClockFrequenceT());
     Clock::PllClock::SrcClockFreq();
     Clock::PllClock::GetDivider();
-    Clock::PllClock::SetDivider(ClockFrequenceT());
+    Clock::PllClock::SetDivider<2>();
     Clock::PllClock::GetMultipler();   
-    Clock::PllClock::SetMultiplier(ClockFrequenceT());
+    Clock::PllClock::SetMultiplier<8>();
 #if defined(RCC_PLLCFGR_PLLP)
     Clock::PllClock::GetSystemOutputDivider();
-    Clock::PllClock::SetSystemOutputDivider(ClockFrequenceT());
+    Clock::PllClock::SetSystemOutputDivider<2>();
     Clock::PllClock::GetUsbOutputDivider();
-    Clock::PllClock::SetUsbOutputDivider(ClockFrequenceT());
+    Clock::PllClock::SetUsbOutputDivider<2>();
 #endif
-    Clock::PllClock::SelectClockSource(Clock::PllClock::ClockSource());
+    Clock::PllClock::SelectClockSource<Clock::PllClock::External>();
     Clock::PllClock::GetClockSource();
     Clock::PllClock::ClockFreq();
     Clock::PllClock::Enable();
@@ -59,22 +58,21 @@ void ClockCompileTest()
 #endif
 
     Clock::SysClock::MaxFreq();
-    Clock::SysClock::SelectClockSource(Clock::SysClock::ClockSource());
+    Clock::SysClock::SelectClockSource<Clock::SysClock::Pll>();
     Clock::SysClock::ClockFreq();
     Clock::SysClock::SrcClockFreq();
-    Clock::SysClock::SetClockFreq(ClockFrequenceT());
 
     Clock::AhbClock::ClockFreq();
-    Clock::AhbClock::SetPrescaler(Clock::AhbClock::Prescaler());
+    Clock::AhbClock::SetPrescaler<Clock::AhbClock::Div1>();
 
     Clock::Apb1Clock::ClockFreq();
-    Clock::Apb1Clock::SetPrescaler(Clock::Apb1Clock::Prescaler());
+    Clock::Apb1Clock::SetPrescaler<Clock::Apb1Clock::Div2>();
 
     Clock::Apb2Clock::ClockFreq();
-    Clock::Apb2Clock::SetPrescaler(Clock::Apb2Clock::Prescaler());
+    Clock::Apb2Clock::SetPrescaler<Clock::Apb2Clock::Div1>();
 #if defined (RCC_CFGR_ADCPRE)
     Clock::AdcClockSource::SelectClockSource();
-    Clock::AdcClockSource::SetPrescaler(Clock::AdcClockSource::Prescaler());
+    Clock::AdcClockSource::SetPrescaler<Clock::AdcClockSource::Div6>();
     Clock::AdcClockSource::SrcClockFreq();
     Clock::AdcClockSource::ClockFreq();
 #endif
@@ -99,6 +97,15 @@ void DmaCompileTest()
     using DmaCh = Dma1Channel1;
 #endif
     DmaCh::Transfer(DmaCh::Mode(), nullptr, nullptr, 0);
+    DmaCh::TransferList(DmaCh::Mode(), static_cast<const DmaDescriptor*>(nullptr), 0, nullptr);
+    DmaCh::TransferList(DmaCh::Mode(), static_cast<const DmaReceiveDescriptor*>(nullptr), 0, nullptr);
+    DmaCh::CurrentDescriptor();
+#if defined(DMA_SxCR_DBM)
+    DmaCh::TransferDoubleBuffer(DmaCh::Mode(), nullptr, nullptr, nullptr, 0);
+    DmaCh::IdleBufferIndex();
+    DmaCh::IdleBuffer();
+    DmaCh::SetIdleBuffer(nullptr);
+#endif
     DmaCh::SetTransferCallback(nullptr);
     DmaCh::Ready();
     DmaCh::Enabled();
@@ -124,33 +131,83 @@ void DmaCompileTest()
 
     using DmaMod = Dma1;
 
-    DmaMod::TransferError<0>();
-    DmaMod::HalfTransfer<0>();
-    DmaMod::TransferComplete<0>();
+    constexpr int Channel = DmaCh::Channel;
+
+    DmaMod::TransferError<Channel>();
+    DmaMod::HalfTransfer<Channel>();
+    DmaMod::TransferComplete<Channel>();
 #if defined(DMA_SxCR_EN)
-    DmaMod::FifoError<0>();
-    DmaMod::DirectError<0>();
-    DmaMod::ClearFifoError<0>();
-    DmaMod::ClearDirectError<0>();
+    DmaMod::FifoError<Channel>();
+    DmaMod::DirectError<Channel>();
+    DmaMod::ClearFifoError<Channel>();
+    DmaMod::ClearDirectError<Channel>();
 #endif
 #if defined(DMA_CCR_EN)
-    DmaMod::Interrupt<0>();
-    DmaMod::ClearInterrupt<0>();
+    DmaMod::Interrupt<Channel>();
+    DmaMod::ClearInterrupt<Channel>();
 #endif
-    DmaMod::ClearChannelFlags<0>();
-    DmaMod::ClearTransferError<0>();
-    DmaMod::ClearHalfTransfer<0>();
-    DmaMod::ClearTransferComplete<0>();
+    DmaMod::ClearChannelFlags<Channel>();
+    DmaMod::ClearTransferError<Channel>();
+    DmaMod::ClearHalfTransfer<Channel>();
+    DmaMod::ClearTransferComplete<Channel>();
     DmaMod::Enable();
     DmaMod::Disable();
 }
 
+#include <zhele/dma_memory.h>
+void DmaMemoryCompileTest()
+{
+#if defined (DMA1_Stream0)
+    using Memory = DmaMemory<Dma2Stream0>;
+#else
+    using Memory = DmaMemory<Dma1Channel1>;
+#endif
+    Memory::Copy(nullptr, nullptr, 0);
+    Memory::Fill(nullptr, 0, 0);
+    Memory::Busy();
+    Memory::SetThreshold(0);
+    Memory::Threshold();
+}
+
+#include <zhele/dma_allocator.h>
+void DmaAllocatorCompileTest()
+{
+    using template_utils::type_list;
+#if defined (DMA1_Stream0)
+    using Pool = type_list<Dma1Stream0, Dma1Stream1>;
+    using Fixed = Dma1Stream2;
+#else
+    using Pool = type_list<Dma1Channel1, Dma1Channel2>;
+    using Fixed = Dma1Channel3;
+#endif
+#if defined(DMAMUX1)
+    using First = DmaUser<DmamuxRequestInput::Usart1Tx>;
+    using Second = DmaUser<DmamuxRequestInput::Usart1Rx, Fixed>;
+    using Third = DmaUser<DmamuxRequestInput::Spi1Tx>;
+#else
+    using First = DmaUser<0>;
+    using Second = DmaUser<1, Fixed>;
+    using Third = DmaUser<2>;
+#endif
+    using Allocator = DmaAllocator<Pool, type_list<First, Second, Third>>;
+
+    static_assert(std::is_same_v<Allocator::Channel<First>, template_utils::type_unbox<Pool::get<0>()>>);
+    static_assert(std::is_same_v<Allocator::Channel<Second>, Fixed>);
+    static_assert(std::is_same_v<Allocator::Channel<Third>, template_utils::type_unbox<Pool::get<1>()>>);
+    Allocator::Init();
+}
+
 #include <zhele/i2c.h>
 void I2cCompileTest()
 {
     using I2c = I2c1;
 
     I2c::Init();
+#if defined(I2C_TYPE_1)
+    I2c::Init<16000000, 1000000>();
+    I2c::Init<48000000, 400000, 100, 10>();
+    I2c::EnableFastModePlus();
+#endif
     I2c::WriteU8(0, 0, 0);
     I2c::Write(0, 0, nullptr, 0);
     I2c::WriteAsync(0, 0, nullptr, 0);
@@ -169,6 +226,20 @@ void I2cCompileTest()
     I2c::SelectPins<IO::Pb6, IO::Pb7>();
 }
 
+#include <zhele/soft_i2c.h>
+void SoftI2cCompileTest()
+{
+    using I2c = SoftI2c<IO::Pb6, IO::Pb7, 72000000>;
+
+    I2c::Init();
+    I2c::Init<400000>();
+    I2c::WriteU8(0, 0, 0);
+    I2c::Write(0, 0, nullptr, 0, I2cOpts::RegAddr16Bit);
+    I2c::ReadU8(0, 0, I2cOpts::RegAddrNone);
+    I2c::Read(0, 0, nullptr, 0, I2cOpts::DevAddr10Bit);
+    I2c::Busy();
+}
+
 #include <zhele/ioports.h>
 void IoPortsCompileTest()
 {
@@ -185,20 +256,40 @@ void IoPortsCompileTest()
     Port::Toggle<0>();
     Port::Set<0>();
     Port::Clear<0>();
-    Port::SetConfiguration(0, Port::Configuration::Analog);
-    Port::SetConfiguration<0, Port::Configuration::Analog>();
-    Port::SetSpeed(0, Port::Speed::Slow);
-    Port::SetSpeed<0, Port::Speed::Slow>();
-    Port::SetPullMode(0, Port::PullMode::NoPull);
-    Port::SetPullMode<0, Port::PullMode::NoPull>();
-    Port::SetDriverType(0, Port::DriverType::PushPull);
-    Port::SetDriverType<0, Port::DriverType::PushPull>();
+    Port::SetConfiguration(Port::Configuration::Analog, 0);
+    Port::SetConfiguration<Port::Configuration::Analog, 0>();
+    Port::SetSpeed(Port::Speed::Slow, 0);
+    Port::SetSpeed<Port::Speed::Slow, 0>();
+    Port::SetPullMode(Port::PullMode::NoPull, 0);
+    Port::SetPullMode<Port::PullMode::NoPull, 0>();
+    Port::SetDriverType(Port::DriverType::PushPull, 0);
+    Port::SetDriverType<Port::DriverType::PushPull, 0>();
     Port::AltFuncNumber(0, 0);
     Port::AltFuncNumber<0, 0>();
     Port::Enable();
     Port::Disable();
 }
 
+void BitBandCompileTest()
+{
+    static_assert(BitBand::InRegion(0x40013000) && BitBand::InRegion(0x20000400));
+    static_assert(!BitBand::InRegion(0x50000000) && !BitBand::InRegion(0x10000000));
+    static_assert(BitBand::Alias(0x40013000, 8) == 0x42260020);
+    static_assert(BitBand::Alias(0x20000004, 31) == 0x220000fc);
+
+    using Bit = BitBandIoBit<0x40013000, uint32_t, 8>;
+    Bit::Set();
+    Bit::Clear();
+    Bit::IsSet();
+
+    static BitBandFlags flags;
+    flags.Set(0);
+    flags.Clear(0);
+    flags.Write(1, true);
+    flags.IsSet(1);
+    flags.Get();
+}
+
 #include <zhele/iopins.h>
 
 #include <zhele/pinlist.h>
@@ -209,20 +300,21 @@ void PinListCompileTest()
     Pins::Enable();
     Pins::Write(0);
     Pins::Write<0>();
+    Pins::WriteByTable(0);
     Pins::Read();
     Pins::Set(0);
     Pins::Clear(0);
-    Pins::SetConfiguration(0, Pins::Configuration::Analog);
-    Pins::SetConfiguration<0, Pins::Configuration::Analog>();
+    Pins::SetConfiguration(Pins::Configuration::Analog, 0);
+    Pins::SetConfiguration<Pins::Configuration::Analog, 0>();
     Pins::SetConfiguration<Pins::Configuration::Analog>();
-    Pins::SetSpeed(0, Pins::Speed::Slow);
-    Pins::SetSpeed<0, Pins::Speed::Slow>();
+    Pins::SetSpeed(Pins::Speed::Slow, 0);
+    Pins::SetSpeed<Pins::Speed::Slow, 0>();
     Pins::SetSpeed<Pins::Speed::Slow>();
-    Pins::SetPullMode(0, Pins::PullMode::NoPull);
-    Pins::SetPullMode<0, Pins::PullMode::NoPull>();
+    Pins::SetPullMode(Pins::PullMode::NoPull, 0);
+    Pins::SetPullMode<Pins::PullMode::NoPull, 0>();
     Pins::SetPullMode<Pins::PullMode::NoPull>();
-    Pins::SetDriverType(0, Pins::DriverType::PushPull);
-    Pins::SetDriverType<0, Pins::DriverType::PushPull>();
+    Pins::SetDriverType(Pins::DriverType::PushPull, 0);
+    Pins::SetDriverType<Pins::DriverType::PushPull, 0>();
     Pins::SetDriverType<Pins::DriverType::PushPull>();
     Pins::AltFuncNumber(0, 0);
     Pins::AltFuncNumber<0, 0>();
@@ -231,6 +323,20 @@ void PinListCompileTest()
     using pin = Pins::Pin<0>;
 }
 
+#include <zhele/pin_configuration.h>
+void PinConfigurationCompileTest()
+{
+    using Leds = IO::PinSettings<IO::PinList<IO::Pa0, IO::Pa1>, IO::Pa0::Configuration::Out, IO::Pa0::DriverType::OpenDrain>;
+    using Button = IO::PinSettings<IO::Pb0, IO::Pb0::Configuration::In, IO::Pb0::PullMode::PullUp>;
+    using Configuration = IO::PinConfiguration<template_utils::type_list<Leds, Button>, IO::PinSettings<IO::Pa0, IO::Pa0::Configuration::Out>>;
+    static_assert(!Configuration::HasConflicts());
+    static_assert(IO::PinConfiguration<Leds, IO::PinSettings<IO::Pa1, IO::Pa1::Configuration::In>>::HasConflicts());
+
+    Configuration::Apply();
+    constexpr IO::PortConfigurationImage image = Configuration::Image<IO::Porta>;
+    static_assert(!image.Conflict);
+}
+
 #include <zhele/spi.h>
 void SpiCompileTest()
 {
@@ -247,15 +353,41 @@ void SpiCompileTest()
     SpiBus::SetSlaveControl(SpiBus::SlaveControl::SoftSlaveControl);
     SpiBus::SetSS();
     SpiBus::Send(0);
+    SpiBus::Transfer(nullptr, nullptr, 0);
+    SpiBus::Transfer<SpiBus::DataSize::DataSize16>(nullptr, nullptr, 0);
     SpiBus::SendAsync(nullptr, nullptr, 0);
     SpiBus::Write(0);
     SpiBus::WriteAsync(nullptr, 0);
+    SpiBus::WriteAsyncList(nullptr, 0);
     SpiBus::Read();
     SpiBus::ReadAsync(nullptr, 0);
     SpiBus::SelectPins(0, 0, 0, 0);
     SpiBus::SelectPins<0, 0, 0, 0>();
 }
 
+#include <zhele/soft_spi.h>
+void SoftSpiCompileTest()
+{
+    using SpiBus = SoftSpi<IO::Pb15, IO::Pb14, IO::Pb13, IO::Pb12, 72000000>;
+
+    SpiBus::Init();
+    SpiBus::Init<1000000>();
+    SpiBus::SetDivider(SpiBus::ClockDivider::Slow);
+    SpiBus::SetClockPolarity(SpiBus::ClockPolarity::ClockPolarityHigh);
+    SpiBus::SetClockPhase(SpiBus::ClockPhase::ClockPhaseFallingEdge);
+    SpiBus::SetBitOrder(SpiBus::BitOrder::LsbFirst);
+    SpiBus::SetDataSize(SpiBus::DataSize::DataSize16);
+    SpiBus::SetSS();
+    SpiBus::ClearSS();
+    SpiBus::Busy();
+    SpiBus::Send(0);
+    SpiBus::Transfer(nullptr, nullptr, 0);
+    SpiBus::Transfer<SpiBus::DataSize16>(nullptr, nullptr, 0);
+    SpiBus::Write(0);
+    SpiBus::Read();
+    static_assert(SpiBus::HalfPeriod(SpiBus::Div2) == 1 && SpiBus::HalfPeriod(SpiBus::Div256) == 128);
+}
+
 #include <zhele/timer.h>
 void TimerCompileTest()
 {
@@ -298,9 +430,90 @@ void TimerCompileTest()
     TimPWM::SetOutputFastMode(TimPWM::FastMode::Disable);
     TimPWM::SelectPins(0);
     TimPWM::SelectPins<0>();
+
+#if defined (DMA1_Stream0)
+    using TimBurst = Tim::DmaBurst<Dma1Stream2>;
+#else
+    using TimBurst = Tim::DmaBurst<Dma1Channel3>;
+#endif
+    static const uint16_t duty[2][4] {};
+    static const uint32_t periods[2] {};
+    TimBurst::Start(Tim::BurstRegister::CCR1, 4, &duty[0][0], 2);
+    TimBurst::Start(Tim::BurstRegister::ARR, 1, periods, 2, true);
+    TimBurst::Done();
+    TimBurst::Stop();
+
+#if defined (DMA1_Stream0)
+    using TimCapture = Tim::InputCapture<0>::DmaCapture<Dma1Stream4>;
+#else
+    using TimCapture = Tim::InputCapture<0>::DmaCapture<Dma1Channel6>;
+#endif
+    static Tim::Counter edges[8];
+    TimCapture::Start(edges, 8);
+    TimCapture::Position();
+    TimCapture::Stop();
+}
+
+#include <zhele/timer_wheel.h>
+void TimerWheelCompileTest()
+{
+    using Wheel = Timers::TimerWheel<Timers::Timer3, 1>;
+    static Timers::SoftTimer timer;
+    timer.SetCallback([] {});
+    timer.IsActive();
+    timer.Expiry();
+    Wheel::Init(1000);
+    Wheel::Now();
+    Wheel::Start(timer, 10);
+    Wheel::Start(timer, 10, Wheel::MaxDelay);
+    Wheel::Cancel(timer);
+    Wheel::NextExpiryDelay();
+    Wheel::IRQHandler();
+}
+
+#include <zhele/monotonic_clock.h>
+void MonotonicClockCompileTest()
+{
+    using Clock = Timers::MonotonicClock<Timers::Timer3, 2>;
+    Clock::Init(1000000);
+    Clock::Frequency();
+    Clock::Now();
+    Clock::NowNs();
+    Clock::ToNanoseconds(0);
+    Clock::IRQHandler();
+}
+
+#include <zhele/pulse_capture.h>
+#include <zhele/drivers/ir.h>
+void PulseCaptureCompileTest()
+{
+#if defined (DMA1_Stream0)
+    using Receiver = Timers::PulseCapture<Timers::Timer3, Dma1Stream4>;
+    Receiver::Init(1000000, 10000, Receiver::Edges::Both, 5);
+#else
+    using Receiver = Timers::PulseCapture<Timers::Timer3, Dma1Channel6>;
+    Receiver::Init(1000000, 10000);
+#endif
+    Receiver::Frame frame;
+    if(Receiver::ReadFrame(frame))
+        Drivers::NecDecoder::Decode(frame);
+    frame.Size();
+    Receiver::DroppedFrames();
+    Receiver::IRQHandler();
+}
+
+#include <zhele/tickless_idle.h>
+void TicklessIdleCompileTest()
+{
+    using Idle = Timers::TicklessIdle<Timers::TimerWheel<Timers::Timer3, 1>>;
+    static volatile bool complete = false;
+    Idle::EnableStop();
+    Idle::DisableStop();
+    Idle::Enter();
+    Idle::Enter([] { return complete; });
 }
 
-#include <zhele/sart.h>
+#include <zhele/usart.h>
 void UsartCompileTest()
 {
     using UsartBus = Usart1;
@@ -313,8 +526,10 @@ void UsartCompileTest()
     UsartBus::ReadReady();
     UsartBus::Read();
     UsartBus::EnableAsyncRead(nullptr, 0);
+    UsartBus::EnableAsyncReadList(nullptr, 0);
     UsartBus::WriteReady();
     UsartBus::Write(nullptr, 0);
+    UsartBus::WriteAsyncList(nullptr, 0);
     UsartBus::Write(0);
     UsartBus::EnableInterrupt(UsartBus::InterruptFlags::AllInterrupts);
     UsartBus::DisableInterrupt(UsartBus::InterruptFlags::AllInterrupts);
@@ -325,6 +540,35 @@ void UsartCompileTest()
     UsartBus::SelectTxRxPins<0, 0>();
 }
 
+#include <zhele/soft_usart.h>
+void SoftUsartCompileTest()
+{
+    using UsartBus = SoftUsart<IO::Pa2, IO::Pa3, 72000000>;
+
+    UsartBus::Init<9600>();
+    UsartBus::Init(115200, UsartBus::UsartMode::DataBits9 | UsartBus::UsartMode::TwoStopBits | UsartBus::UsartMode::EvenParity);
+    UsartBus::SetConfig(UsartBus::UsartMode::TxEnable);
+    UsartBus::SetBaud(9600);
+    UsartBus::ReadReady();
+    UsartBus::Read();
+    UsartBus::WriteReady();
+    UsartBus::Write(nullptr, 0);
+    UsartBus::Write(0);
+}
+
+#include <zhele/delay.h>
+void DelayCompileTest()
+{
+    delay_ns<100, 72000000>();
+    delay_us<10, 72000000>();
+    delay_ms<1, 72000000>();
+    static_assert(Private::NanosecondsToCycles<1000, 72000000> == 72);
+    static_assert(Private::NanosecondsToCycles<100, 8000000> == 1);
+
+    static CycleCounter::Ticks cycles;
+    ScopedCycles measure(cycles);
+}
+
 /*
 #include <one_wire.h>
 void OneWireCompileTest()
@@ -363,4 +607,63 @@ void RingBufferTest()
     buffer64[0] = 42;
     constBuffer64[0];
 
-}
\ No newline at end of file
+}
+#include <zhele/containers/spsc_ring_buffer.h>
+void SpscRingBufferTest()
+{
+    using Buffer = Zhele::Containers::SpscRingBuffer<100, uint8_t>;
+    Buffer buffer;
+    const Buffer& constBuffer = buffer;
+    uint8_t data[16] {};
+    buffer.capacity();
+    buffer.size();
+    buffer.free_space();
+    buffer.empty();
+    buffer.full();
+    buffer.front();
+    constBuffer.front();
+    buffer.push_back(42);
+    buffer.pop_front();
+    buffer.push(data);
+    buffer.pop(data);
+    buffer.commit(buffer.write_region().size());
+    buffer.consume(buffer.read_region().size());
+    buffer.clear();
+    buffer[0] = 42;
+    constBuffer[0];
+}
+#include <zhele/common/delegate.h>
+namespace DelegateTestData
+{
+    struct Counter
+    {
+        int Add(int value) { return _value += value; }
+        int _value = 0;
+    };
+    constexpr int Twice(int value) { return value * 2; }
+    constexpr int Scale(const int& factor, int value) { return factor * value; }
+    constexpr int Factor = 3;
+}
+void DelegateTest()
+{
+    using namespace DelegateTestData;
+    using Callback = Delegate<int(int)>;
+    static_assert(sizeof(Callback) == 2 * sizeof(void*));
+
+    static_assert(Callback{} == nullptr);
+    static_assert(Callback{Twice}(21) == 42);
+    static_assert(Callback{[](int value) { return value + 1; }}(41) == 42);
+    static_assert(Callback::Bind<Twice>()(21) == 42);
+    Callback::Bind<Scale>(Factor)(14);
+
+    Counter counter;
+    Callback method = Callback::Bind<&Counter::Add>(counter);
+    method(40);
+    method(2);
+
+    int offset = 40;
+    auto stateful = [&offset](int value) { return offset + value; };
+    Callback lambda = stateful;
+    lambda(2);
+    static_assert(!std::is_constructible_v<Callback, decltype(stateful)&&>);
+}
@@ -0,0 +1,652 @@
+/**
+ * @file
+ * Implements host micro-benchmarks
+ * Build with optimization (-O2) for host, for example:
+ * g++ -std=c++23 -O2 -Iinclude test/src/host_benchmark.cpp -o host_benchmark
+ * Benchmarks of peripheral code are compiled only in host build (ZHELE_HOST_REGISTERS,
+ * see BUILDING.md).
+ *
+ * Results that do not depend on host speed (register accesses, model cycles, interrupts)
+ * are checked against regression thresholds, benchmark fails if some of them is exceeded.
+ * Throughput and host cycles are only printed.
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#if defined(ZHELE_HOST_REGISTERS)
+    // Before CMSIS headers: their __I/__O macros break intrinsics declarations
+    #include <x86intrin.h>
+#endif
+
+#include <zhele/containers/ring_buffer.h>
+#include <zhele/containers/spsc_ring_buffer.h>
+#if defined(ZHELE_HOST_REGISTERS)
+    #include <zhele/dma_memory.h>
+    #include <zhele/i2c.h>
+    #include <zhele/iopins.h>
+    #include <zhele/pinlist.h>
+    #include <zhele/soft_i2c.h>
+    #include <zhele/soft_spi.h>
+    #include <zhele/soft_usart.h>
+    #include <zhele/tickless_idle.h>
+    #include <zhele/timer_wheel.h>
+    #include <zhele/usart.h>
+    #include <zhele/usart_stream.h>
+    #include <zhele/common/host/access_trace.h>
+    #include <zhele/platform/stm32/common/host/models.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+using namespace Zhele;
+
+/**
+ * @brief Runs benchmark body and prints throughput
+ *
+ * @param [in] name Benchmark name
+ * @param [in] bytes Processed bytes count
+ * @param [in] body Benchmark body (returns checksum)
+ */
+template<typename _Body>
+void Measure(const char* name, uint64_t bytes, _Body body)
+{
+    auto start = std::chrono::steady_clock::now();
+    uint32_t checksum = body();
+    auto stop = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(stop - start).count();
+    std::printf("%-40s %10.1f MB/s (checksum %08x)\n", name, bytes / seconds / 1e6, checksum);
+}
+
+static unsigned Regressions = 0;
+
+/**
+ * @brief Checks benchmark result against regression threshold
+ *
+ * @param [in] name Result name
+ * @param [in] value Result
+ * @param [in] limit Maximum allowed value
+ */
+void ExpectAtMost(const char* name, double value, double limit)
+{
+    if(value <= limit)
+        return;
+
+    std::printf("REGRESSION: %s is %.2f, limit %.2f\n", name, value, limit);
+    ++Regressions;
+}
+
+static constexpr unsigned RingBufferSize = 1024;
+static constexpr unsigned ChunkSize = 64;
+static constexpr uint64_t StreamSize = 256ull << 20;
+
+void RingBufferBenchmark()
+{
+    static uint8_t source[ChunkSize];
+    static uint8_t destination[ChunkSize];
+    for(unsigned i = 0; i < ChunkSize; ++i)
+        source[i] = i;
+
+    Measure("RingBuffer push_back/pop_front", StreamSize, [] {
+        static Containers::RingBuffer<RingBufferSize, uint8_t> buffer;
+        uint32_t checksum = 0;
+        for(uint64_t done = 0; done < StreamSize; done += ChunkSize)
+        {
+            for(unsigned i = 0; i < ChunkSize; ++i)
+                buffer.push_back(source[i]);
+            for(unsigned i = 0; i < ChunkSize; ++i)
+            {
+                destination[i] = buffer.front();
+                buffer.pop_front();
+            }
+            checksum += destination[(done / ChunkSize) % ChunkSize];
+        }
+        return checksum;
+    });
+
+    Measure("SpscRingBuffer push_back/pop_front", StreamSize, [] {
+        static Containers::SpscRingBuffer<RingBufferSize, uint8_t> buffer;
+        uint32_t checksum = 0;
+        for(uint64_t done = 0; done < StreamSize; done += ChunkSize)
+        {
+            for(unsigned i = 0; i < ChunkSize; ++i)
+                buffer.push_back(source[i]);
+            for(unsigned i = 0; i < ChunkSize; ++i)
+            {
+                destination[i] = buffer.front();
+                buffer.pop_front();
+            }
+            checksum += destination[(done / ChunkSize) % ChunkSize];
+        }
+        return checksum;
+    });
+
+    Measure("SpscRingBuffer push/pop (span)", StreamSize, [] {
+        static Containers::SpscRingBuffer<RingBufferSize, uint8_t> buffer;
+        uint32_t checksum = 0;
+        for(uint64_t done = 0; done < StreamSize; done += ChunkSize)
+        {
+            buffer.push(source);
+            buffer.pop(destination);
+            checksum += destination[(done / ChunkSize) % ChunkSize];
+        }
+        return checksum;
+    });
+
+    Measure("SpscRingBuffer write/read regions", StreamSize, [] {
+        static Containers::SpscRingBuffer<RingBufferSize, uint8_t> buffer;
+        uint32_t checksum = 0;
+        for(uint64_t done = 0; done < StreamSize; done += ChunkSize)
+        {
+            // Same as DMA (or PMA copy) working with buffer memory directly
+            unsigned written = 0;
+            while(written < ChunkSize)
+            {
+                auto region = buffer.write_region();
+                unsigned count = std::min<unsigned>(region.size(), ChunkSize - written);
+                std::memcpy(region.data(), source + written, count);
+                buffer.commit(count);
+                written += count;
+            }
+            while(!buffer.empty())
+            {
+                auto region = buffer.read_region();
+                checksum += region[region.size() - 1];
+                buffer.consume(region.size());
+            }
+        }
+        return checksum;
+    });
+}
+
+#if defined(ZHELE_HOST_REGISTERS)
+static constexpr unsigned LinesCount = 200000;
+
+/**
+ * @brief Compares blocking USART write with transmit queue
+ *
+ * @details
+ * Host model has no baud rate, so throughput shows CPU cost of sending only.
+ * Important values are caller latency (time spent in Write call) and register
+ * accesses made by Write call (each of them is bus transaction on MCU).
+ */
+void UsartTxQueueBenchmark()
+{
+    using TxQueue = UsartTxQueue<Usart1, RingBufferSize>;
+    static constexpr unsigned LinesPerBatch = RingBufferSize / ChunkSize;
+    static uint8_t line[ChunkSize];
+    for(unsigned i = 0; i < ChunkSize; ++i)
+        line[i] = 'a' + i % 26;
+
+    Host::FlagModel status(Host::AddressOf(&Usart1::Regs::Get()->STATUS_REG), Usart1::TxEmptyInt | Usart1::TxCompleteInt);
+    Host::DmaChannelModel<Usart1::DmaTx> dmaTx;
+    Usart1::Init(115200);
+
+    Measure("Usart::Write (blocking)", uint64_t(LinesCount) * ChunkSize, [] {
+        for(unsigned i = 0; i < LinesCount; ++i)
+            Usart1::Write(line, ChunkSize);
+        return uint32_t(Usart1::Regs::Get()->TRANSMIT_DATA_REG);
+    });
+
+    Measure("UsartTxQueue::Write + DMA chunks", uint64_t(LinesCount) * ChunkSize, [] {
+        for(unsigned i = 0; i < LinesCount; i += LinesPerBatch)
+        {
+            for(unsigned j = 0; j < LinesPerBatch; ++j)
+                TxQueue::Write(line, ChunkSize);
+            while(!TxQueue::Idle())
+                Host::RegisterFile::Step();
+        }
+        return uint32_t(TxQueue::Rejected());
+    });
+
+    // Caller latency: time of Write calls only (queue is drained between batches)
+    std::chrono::duration<double> blocking{}, queued{};
+    for(unsigned i = 0; i < LinesCount; i += LinesPerBatch)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for(unsigned j = 0; j < LinesPerBatch; ++j)
+            Usart1::Write(line, ChunkSize);
+        blocking += std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        for(unsigned j = 0; j < LinesPerBatch; ++j)
+            TxQueue::Write(line, ChunkSize);
+        queued += std::chrono::steady_clock::now() - start;
+
+        while(!TxQueue::Idle())
+            Host::RegisterFile::Step();
+    }
+    std::printf("%-40s %10.1f ns/call\n", "Usart::Write latency", blocking.count() / LinesCount * 1e9);
+    std::printf("%-40s %10.1f ns/call\n", "UsartTxQueue::Write latency", queued.count() / LinesCount * 1e9);
+
+    // Register accesses made by caller
+    uint32_t blockingAccesses, queuedAccesses;
+    {
+        Host::ScopedAccessTrace trace;
+        Usart1::Write(line, ChunkSize);
+        blockingAccesses = Host::AccessTrace::Total().Total();
+    }
+    {
+        Host::ScopedAccessTrace trace;
+        TxQueue::Write(line, ChunkSize); // Starts DMA (queue is idle)
+        TxQueue::Write(line, ChunkSize); // Only copy to queue
+        queuedAccesses = Host::AccessTrace::Total().Total();
+    }
+    std::printf("%-40s %10u accesses/line\n", "Usart::Write bus cost", blockingAccesses);
+    std::printf("%-40s %10.1f accesses/line\n", "UsartTxQueue::Write bus cost", queuedAccesses / 2.0);
+    ExpectAtMost("UsartTxQueue::Write bus cost (part of blocking)", queuedAccesses / 2.0 / blockingAccesses, 0.25);
+}
+
+static constexpr unsigned PinListWrites = 1000000;
+
+/**
+ * @brief Writes pins of pin list on given port bit by bit (as generic PinList did before runs)
+ *
+ * @tparam _Pins Pin list
+ * @tparam _Port Port
+ * @param [in] value Pin list value
+ */
+template<typename _Pins, typename _Port, unsigned... _Index>
+void WritePortByBits(typename _Pins::DataType value, std::integer_sequence<unsigned, _Index...>)
+{
+    uint16_t mask = 0, result = 0;
+    ((std::is_same_v<typename _Pins::template Pin<_Index>::Port, _Port>
+        ? (mask |= 1 << _Pins::template Pin<_Index>::Number, result |= ((value >> _Index) & 1) << _Pins::template Pin<_Index>::Number)
+        : 0), ...);
+    _Port::ClearAndSet(mask, result);
+}
+
+/**
+ * @brief Measures cycles (host TSC) and register accesses of one pin list write
+ *
+ * @param [in] name Benchmark name
+ * @param [in] write Write function
+ *
+ * @returns Register accesses of one write
+ */
+template<typename _Write>
+uint32_t MeasurePinListWrite(const char* name, _Write write)
+{
+    uint64_t start = __rdtsc();
+    for(unsigned i = 0; i < PinListWrites; ++i)
+        write(static_cast<uint8_t>(i));
+    uint64_t cycles = __rdtsc() - start;
+
+    uint32_t accesses;
+    {
+        Host::ScopedAccessTrace trace;
+        write(0xa5);
+        accesses = Host::AccessTrace::Total().Total();
+    }
+    std::printf("%-40s %10.1f cycles/write %4u accesses\n", name, double(cycles) / PinListWrites, accesses);
+    return accesses;
+}
+
+/**
+ * @brief Compares 8-bit pin list writes: contiguous pins, scattered pins (runs and lookup table)
+ * and pin-by-pin shuffle
+ *
+ * @details
+ * Host cycles include register file notification for each register access,
+ * so difference between variants with equal accesses count is cost of value shuffle.
+ */
+void PinListBenchmark()
+{
+    using Contiguous = IO::PinList<IO::Pa0, IO::Pa1, IO::Pa2, IO::Pa3, IO::Pa4, IO::Pa5, IO::Pa6, IO::Pa7>;
+    using Scattered = IO::PinList<IO::Pa0, IO::Pa1, IO::Pb5, IO::Pb6, IO::Pa7, IO::Pb2, IO::Pa8, IO::Pa9>;
+
+    uint32_t contiguous = MeasurePinListWrite("PinList::Write contiguous", [](uint8_t value) { Contiguous::Write(value); });
+    MeasurePinListWrite("PinList::Write scattered (pin by pin)", [](uint8_t value) {
+        WritePortByBits<Scattered, IO::Porta>(value, std::make_integer_sequence<unsigned, 8>{});
+        WritePortByBits<Scattered, IO::Portb>(value, std::make_integer_sequence<unsigned, 8>{});
+    });
+    uint32_t runs = MeasurePinListWrite("PinList::Write scattered (runs)", [](uint8_t value) { Scattered::Write(value); });
+    uint32_t table = MeasurePinListWrite("PinList::WriteByTable scattered", [](uint8_t value) { Scattered::WriteByTable(value); });
+
+    // One store per port
+    ExpectAtMost("PinList::Write contiguous accesses", contiguous, 1);
+    ExpectAtMost("PinList::Write scattered (runs) accesses", runs, 2);
+    ExpectAtMost("PinList::WriteByTable scattered accesses", table, 2);
+}
+
+/**
+ * @brief Finds size from which DMA memory copy is cheaper for CPU than copy loop
+ *
+ * @details
+ * CPU cost of DMA copy is register accesses made by DmaMemory (setup and completion interrupt),
+ * CPU cost of copy loop is bus accesses of word copy (load and store per 4 bytes).
+ * Crossover is smallest size for which DMA costs less, it is reasonable DmaMemory threshold.
+ */
+void DmaMemoryBenchmark()
+{
+#if defined (DMA1_Stream0)
+    using DmaCh = Dma2Stream0;
+#else
+    using DmaCh = Dma1Channel1;
+#endif
+    using Memory = DmaMemory<DmaCh, 0>;
+    Host::DmaChannelModel<DmaCh> model([] { Host::RegisterFile::Raise(DmaCh::IrqHandler); });
+
+    static uint32_t source[1024];
+    static uint32_t destination[1024];
+    for(unsigned i = 0; i < 1024; ++i)
+        source[i] = i;
+
+    size_t crossover = 0;
+    for(size_t size = 8; size <= sizeof(source); size *= 2)
+    {
+        uint32_t dmaAccesses;
+        {
+            Host::ScopedAccessTrace trace;
+            Memory::Copy(destination, source, size);
+            while(Memory::Busy())
+                Host::RegisterFile::Step();
+            dmaAccesses = Host::AccessTrace::Total().Total();
+        }
+        uint32_t cpuAccesses = size / 2;
+        if(crossover == 0 && dmaAccesses < cpuAccesses)
+            crossover = size;
+
+        char name[48];
+        std::snprintf(name, sizeof(name), "DmaMemory::Copy %u bytes bus cost", unsigned(size));
+        std::printf("%-40s %10u accesses (copy loop %u)\n", name, dmaAccesses, cpuAccesses);
+    }
+    std::printf("%-40s %10u bytes\n", "DmaMemory crossover", unsigned(crossover));
+    ExpectAtMost("DmaMemory crossover", crossover == 0 ? std::numeric_limits<double>::infinity() : crossover, 128);
+    DmaCh::SetTransferCallback(nullptr);
+}
+
+static constexpr unsigned SoftBusBytes = 64;
+
+/**
+ * @brief Prints rate of software bus transfer (in model cycles)
+ *
+ * @param [in] name Benchmark name
+ * @param [in] coreFreq Core clock frequency
+ * @param [in] cycles Cycles counter model
+ * @param [in] bits Transferred bits count (including start/stop/acknowledge bits)
+ * @param [in] limit Maximum cycles per bit (regression threshold)
+ * @param [in] transfer Transfer function
+ */
+template<typename _Transfer>
+void MeasureSoftBus(const char* name, unsigned long coreFreq, const Host::CycleCounterModel& cycles, unsigned bits, double limit, _Transfer transfer)
+{
+    uint64_t start = cycles.Cycles();
+    transfer();
+    double cyclesPerBit = double(cycles.Cycles() - start) / bits;
+
+    char label[48];
+    std::snprintf(label, sizeof(label), "%s @ %lu MHz", name, coreFreq / 1000000);
+    std::printf("%-40s %10.1f kbit/s (%.1f cycles/bit)\n", label, coreFreq / cyclesPerBit / 1e3, cyclesPerBit);
+    ExpectAtMost(label, cyclesPerBit, limit);
+}
+
+/**
+ * @brief Measures maximum bit rate of software SPI, I2C and USART for given core clock
+ *
+ * @details
+ * Fastest settings are used (SPI divider 2, I2C clock and baud rate of half core clock),
+ * so bit rate is bound by code, not by configured period. Cycles are counted by model:
+ * it charges fixed cycles count per register access and nothing for instructions between accesses,
+ * so results are upper bounds of real rates. Thresholds are about twice of current cycles per bit.
+ *
+ * @tparam _CoreFreq Core clock frequency
+ */
+template<unsigned long _CoreFreq>
+void SoftBusBenchmark()
+{
+    Host::RegisterFile::Reset();
+    Host::GpioPortModel porta(GPIOA);
+    Host::GpioPortModel portb(GPIOB);
+    Host::I2cPinsDeviceModel<IO::Pb6, IO::Pb7> device(0x50);
+    Host::CycleCounterModel cycles;
+
+    static uint8_t data[SoftBusBytes];
+
+    using Spi = SoftSpi<IO::Pa7, IO::Pa6, IO::Pa5, IO::Pa4, _CoreFreq>;
+    Spi::Init(Spi::Fastest);
+    MeasureSoftBus("SoftSpi::Transfer", _CoreFreq, cycles, SoftBusBytes * 8, 24, [] { Spi::Transfer(data, nullptr, SoftBusBytes); });
+
+    // Address, register address and data bytes with acknowledge bits, start and stop
+    using I2c = SoftI2c<IO::Pb6, IO::Pb7, _CoreFreq>;
+    I2c::template Init<_CoreFreq / 2>();
+    MeasureSoftBus("SoftI2c::Write", _CoreFreq, cycles, (SoftBusBytes + 2) * 9 + 2, 24, [] { I2c::Write(0x50, 0, data, SoftBusBytes); });
+
+    // Start bit, 8 data bits, stop bit
+    using Usart = SoftUsart<IO::Pa2, IO::Pa3, _CoreFreq>;
+    Usart::template Init<_CoreFreq / 2>();
+    MeasureSoftBus("SoftUsart::Write", _CoreFreq, cycles, SoftBusBytes * 10, 12, [] { Usart::Write(data, SoftBusBytes); });
+}
+
+static constexpr unsigned WheelTimersCount = 1000;
+
+/**
+ * @brief Measures timer wheel start/cancel cost and expiration cost with many active timers
+ *
+ * @details
+ * Delays are spread over 2^20 ticks, so timers are distributed over all levels of wheel
+ * and most of them are cascaded before expiration. Interrupts count per timer shows
+ * overhead of tickless compare programming (1.0 is one interrupt per expiration).
+ */
+void TimerWheelBenchmark()
+{
+    using Wheel = Timers::TimerWheel<Timers::Timer3>;
+    static Timers::SoftTimer timers[WheelTimersCount];
+    static uint32_t expired = 0;
+
+    Host::RegisterFile::Reset();
+    Host::TimerModel timer(TIM3, Wheel::IRQHandler);
+    Wheel::Init(1000);
+    for(auto& softTimer : timers)
+        softTimer.SetCallback([] { ++expired; });
+
+    uint32_t seed = 1;
+    auto nextDelay = [&seed] { seed = seed * 1664525 + 1013904223; return (seed >> 12) + 1; };
+
+    uint64_t start = __rdtsc();
+    for(auto& softTimer : timers)
+        Wheel::Start(softTimer, nextDelay());
+    uint64_t startCycles = __rdtsc() - start;
+
+    start = __rdtsc();
+    for(auto& softTimer : timers)
+        Wheel::Cancel(softTimer);
+    uint64_t cancelCycles = __rdtsc() - start;
+
+    for(auto& softTimer : timers)
+        Wheel::Start(softTimer, nextDelay());
+    uint32_t startAccesses;
+    {
+        Host::ScopedAccessTrace trace;
+        Wheel::Start(timers[0], nextDelay());
+        startAccesses = Host::AccessTrace::Total().Total();
+    }
+
+    uint32_t interrupts = timer.Interrupts();
+    start = __rdtsc();
+    timer.Advance(1u << 21);
+    uint64_t expireCycles = __rdtsc() - start;
+    interrupts = timer.Interrupts() - interrupts;
+
+    std::printf("%-40s %10.1f cycles/timer %4u accesses\n", "TimerWheel::Start (1000 active)", double(startCycles) / WheelTimersCount, startAccesses);
+    std::printf("%-40s %10.1f cycles/timer\n", "TimerWheel::Cancel (1000 active)", double(cancelCycles) / WheelTimersCount);
+    std::printf("%-40s %10.1f cycles/timer %4.2f interrupts/timer\n", "TimerWheel expiration (1000 active)", double(expireCycles) / expired, double(interrupts) / expired);
+    ExpectAtMost("TimerWheel interrupts per timer", double(interrupts) / expired, 1.1);
+}
+
+using IdleWheel = Timers::TimerWheel<Timers::Timer3>;
+static constexpr unsigned IdleSeconds = 10;
+static constexpr unsigned IdleCoreFreq = 72000000;
+static constexpr unsigned IdleAccessCycles = 2;
+/// Exception entry (Cortex-M3 registers stacking, return takes the same), not seen by cycle counter model
+static constexpr unsigned IdleExceptionCycles = 12;
+
+static Host::CycleCounterModel* IdleCounter = nullptr;
+static Host::TimerModel* IdleTimer = nullptr;
+static uint64_t IdleSleepSteps = 0;
+static uint64_t IdleIrqCycles = 0;
+static uint64_t IdleLatency = 0;
+static uint32_t IdleWakeups = 0;
+static uint32_t IdleSamples = 0;
+
+/**
+ * @brief Compares idle loop with 1 kHz tick and tickless idle on the same workload
+ *
+ * @details
+ * Workload is sensor node: sample every 100 ms, report every second (1 ms wheel tick).
+ * Core sleeps in TicklessIdle::Enter, wait handler advances timer model to its next event.
+ * Tick scheduler is emulated by periodic timer with one tick period. Awake cycles are
+ * cycles counted by cycle counter model (register accesses, lower bound) plus exception
+ * entry and return per wake-up. Latency is cycles from wake-up event to sample callback.
+ *
+ * @tparam _Tick Run periodic tick
+ */
+template<bool _Tick>
+void TicklessIdleBenchmark()
+{
+    using Idle = Timers::TicklessIdle<IdleWheel>;
+    static Timers::SoftTimer sample([] { IdleLatency += IdleCounter->Cycles() - IdleIrqCycles; ++IdleSamples; });
+    static Timers::SoftTimer report([] {});
+    static Timers::SoftTimer tick([] {});
+
+    Host::RegisterFile::Reset();
+    Host::CycleCounterModel counter(IdleAccessCycles);
+    Host::TimerModel timer(TIM3, [] { ++IdleWakeups; IdleIrqCycles = IdleCounter->Cycles(); IdleWheel::IRQHandler(); });
+    IdleCounter = &counter;
+    IdleTimer = &timer;
+    Host::RegisterFile::SetWaitHandler([] { ++IdleSleepSteps; return IdleTimer->AdvanceToEvent(std::numeric_limits<uint64_t>::max()) != 0; });
+
+    IdleWheel::Init(1000);
+    IdleWheel::Start(sample, 100, 100);
+    IdleWheel::Start(report, 1000, 1000);
+    if constexpr (_Tick)
+        IdleWheel::Start(tick, 1, 1);
+
+    IdleSleepSteps = IdleLatency = 0;
+    IdleWakeups = IdleSamples = 0;
+    uint64_t cycles = counter.Cycles();
+    while(timer.Ticks() < IdleSeconds * 1000)
+        Idle::Enter();
+    uint64_t awake = counter.Cycles() - cycles - IdleSleepSteps * IdleAccessCycles + uint64_t(IdleWakeups) * IdleExceptionCycles * 2;
+
+    IdleWheel::Cancel(sample);
+    IdleWheel::Cancel(report);
+    IdleWheel::Cancel(tick);
+    Host::RegisterFile::SetWaitHandler(nullptr);
+
+    std::printf("%-40s %10.1f wakeups/s %6.1f cycles latency %8.5f%% duty (72 MHz)\n",
+        _Tick ? "Idle with 1 kHz tick (100 ms, 1 s timers)" : "TicklessIdle (100 ms, 1 s timers)",
+        double(IdleWakeups) / IdleSeconds, double(IdleLatency) / IdleSamples + IdleExceptionCycles,
+        100.0 * double(awake) / (double(IdleCoreFreq) * IdleSeconds));
+    if constexpr (!_Tick)
+    {
+        // Wheel deadlines only (report coincides with sample)
+        ExpectAtMost("TicklessIdle wakeups/s", double(IdleWakeups) / IdleSeconds, 10.5);
+        ExpectAtMost("TicklessIdle duty %", 100.0 * double(awake) / (double(IdleCoreFreq) * IdleSeconds), 0.001);
+    }
+}
+
+#if defined(I2C_SR2_BUSY)
+static constexpr unsigned I2cTransactionsCount = 1000;
+static constexpr unsigned I2cReadSize = 16;
+
+/**
+ * @brief Compares blocking I2C read (status polling) with interrupt and DMA driven transaction queue
+ *
+ * @details
+ * Bus time is counted in model steps. Blocking read spends them on status register polling,
+ * transaction queue leaves them to main code (explicit steps here), so register accesses made
+ * by driver (caller and interrupt handlers) show CPU occupancy.
+ */
+void I2cTransactionBenchmark()
+{
+    static uint8_t data[I2cReadSize];
+    static const uint8_t regAddr = 0;
+    static const I2cTransaction transaction {.DevAddr = 0x50, .WriteBuffer = &regAddr, .WriteSize = 1, .ReadBuffer = data, .ReadSize = I2cReadSize};
+
+    Host::DmaChannelModel<I2c1::DmaTx> dmaTx(I2c1::DmaTx::IrqHandler, true);
+    Host::DmaChannelModel<I2c1::DmaRx> dmaRx([] { Host::RegisterFile::Raise(I2c1::DmaRx::IrqHandler); }, true);
+    Host::I2cDeviceModel<I2c1> device(0x50, 9, &dmaTx, &dmaRx);
+    for(unsigned i = 0; i < I2cReadSize; ++i)
+        device.Memory[i] = i;
+    I2c1::Init();
+
+    Measure("I2c::Read (blocking)", uint64_t(I2cTransactionsCount) * I2cReadSize, [] {
+        uint32_t checksum = 0;
+        for(unsigned i = 0; i < I2cTransactionsCount; ++i)
+        {
+            I2c1::Read(0x50, regAddr, data, I2cReadSize);
+            checksum += data[I2cReadSize - 1];
+        }
+        return checksum;
+    });
+
+    Measure("I2c::Enqueue + interrupts", uint64_t(I2cTransactionsCount) * I2cReadSize, [] {
+        uint32_t checksum = 0;
+        for(unsigned i = 0; i < I2cTransactionsCount; ++i)
+        {
+            I2c1::Enqueue(transaction);
+            while(!I2c1::Idle())
+                Host::RegisterFile::Step();
+            checksum += data[I2cReadSize - 1];
+        }
+        return checksum;
+    });
+
+    // Register accesses of driver per transaction
+    uint32_t blockingAccesses, blockingSteps;
+    {
+        uint32_t steps = device.BusSteps();
+        Host::ScopedAccessTrace trace;
+        I2c1::Read(0x50, regAddr, data, I2cReadSize);
+        blockingAccesses = Host::AccessTrace::Total().Total();
+        blockingSteps = device.BusSteps() - steps;
+    }
+    uint32_t queuedAccesses, queuedSteps, interrupts;
+    {
+        uint32_t steps = device.BusSteps();
+        uint32_t raised = device.Interrupts();
+        Host::ScopedAccessTrace trace;
+        I2c1::Enqueue(transaction);
+        while(!I2c1::Idle())
+            Host::RegisterFile::Step();
+        queuedAccesses = Host::AccessTrace::Total().Total();
+        queuedSteps = device.BusSteps() - steps;
+        interrupts = device.Interrupts() - raised;
+    }
+    std::printf("%-40s %10u accesses (%u bus steps)\n", "I2c::Read bus cost", blockingAccesses, blockingSteps);
+    std::printf("%-40s %10u accesses (%u bus steps, %u interrupts + DMA)\n", "I2c::Enqueue bus cost", queuedAccesses, queuedSteps, interrupts);
+    std::printf("%-40s %10.1f %%\n", "I2C queue CPU occupancy vs blocking", 100.0 * queuedAccesses / blockingAccesses);
+    ExpectAtMost("I2C queue CPU occupancy vs blocking", double(queuedAccesses) / blockingAccesses, 1);
+}
+#endif
+#endif
+
+int main()
+{
+    RingBufferBenchmark();
+#if defined(ZHELE_HOST_REGISTERS)
+    UsartTxQueueBenchmark();
+    DmaMemoryBenchmark();
+    PinListBenchmark();
+    SoftBusBenchmark<8000000>();
+    SoftBusBenchmark<48000000>();
+    SoftBusBenchmark<72000000>();
+    SoftBusBenchmark<168000000>();
+    TimerWheelBenchmark();
+    TicklessIdleBenchmark<true>();
+    TicklessIdleBenchmark<false>();
+#if defined(I2C_SR2_BUSY)
+    I2cTransactionBenchmark();
+#endif
+#endif
+
+    return Regressions == 0 ? 0 : 1;
+}
@@ -0,0 +1,1365 @@
+/**
+ * @file
+ * Implements executable tests for host build
+ * Build with ZHELE_HOST_REGISTERS defined, device define (STM32F103xB for example),
+ * CMSIS include paths and -m32. Peripheral registers are backed by host register file,
+ * hardware behaviour is emulated by models from zhele/platform/stm32/common/host/models.h
+ *
+ * Access count tests (*AccessCountTest) are bus-cost regression tests: they assert count of
+ * register reads/writes made by API call. If you make some method cheaper, update expected counts.
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license MIT
+ */
+
+#if !defined(ZHELE_HOST_REGISTERS)
+    #error "Host tests require ZHELE_HOST_REGISTERS"
+#endif
+
+#include <zhele/delay.h>
+#include <zhele/dma.h>
+#include <zhele/dma_memory.h>
+#include <zhele/i2c.h>
+#include <zhele/iopins.h>
+#include <zhele/monotonic_clock.h>
+#include <zhele/pin_configuration.h>
+#include <zhele/pinlist.h>
+#include <zhele/pulse_capture.h>
+#include <zhele/soft_i2c.h>
+#include <zhele/soft_spi.h>
+#include <zhele/spi.h>
+#include <zhele/spi_bus.h>
+#include <zhele/tickless_idle.h>
+#include <zhele/timer_wheel.h>
+#include <zhele/usart.h>
+#include <zhele/usart_stream.h>
+#if defined(USB_PMAADDR)
+    #include <zhele/usb.h>
+#endif
+#include <zhele/containers/spsc_ring_buffer.h>
+#include <zhele/drivers/ir.h>
+#include <zhele/common/host/access_trace.h>
+#include <zhele/platform/stm32/common/host/models.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+
+using namespace Zhele;
+
+void SpscRingBufferHostTest()
+{
+    // Size is not power of 2, indexes run in [0, 20)
+    Containers::SpscRingBuffer<10, uint8_t> buffer;
+    assert(buffer.empty() && !buffer.full() && buffer.read_region().empty());
+    assert(buffer.write_region().size() == 10);
+
+    // Move indexes to the middle: 6 written, 4 consumed
+    const uint8_t data[] = {0, 1, 2, 3, 4, 5};
+    assert(buffer.push(data) == 6);
+    buffer.consume(4);
+    assert(buffer.size() == 2 && buffer.front() == 4);
+
+    // Free space is split at buffer end: write region ends there, next one starts at buffer begin
+    auto region = buffer.write_region();
+    assert(region.size() == 4 && buffer.free_space() == 8);
+    for(unsigned i = 0; i < region.size(); ++i)
+        region[i] = 6 + i;
+    buffer.commit(region.size());
+    region = buffer.write_region();
+    assert(region.size() == 4);
+    for(unsigned i = 0; i < region.size(); ++i)
+        region[i] = 10 + i;
+    buffer.commit(region.size());
+
+    // Wrapped write index has reached read index
+    assert(buffer.full() && !buffer.empty() && buffer.size() == 10 && buffer.free_space() == 0);
+    assert(buffer.write_region().empty() && !buffer.push_back(0xff));
+
+    // Used space is split at buffer end too
+    region = buffer.read_region();
+    assert(region.size() == 6 && region[0] == 4 && region[5] == 9);
+    buffer.consume(region.size());
+    region = buffer.read_region();
+    assert(region.size() == 4 && region[0] == 10 && region[3] == 13);
+    buffer.consume(3);
+    assert(buffer.size() == 1 && buffer.front() == 13 && buffer[0] == 13);
+
+    // Bulk copy across buffer end (and indexes across 2 * size)
+    const uint8_t more[] = {14, 15, 16, 17, 18, 19, 20, 21, 22, 23};
+    assert(buffer.push(more) == 9 && buffer.full());
+    uint8_t read[10] {};
+    assert(buffer.pop(read) == 10);
+    for(unsigned i = 0; i < sizeof(read); ++i)
+        assert(read[i] == 13 + i);
+    assert(buffer.empty() && !buffer.full() && buffer.pop(read) == 0);
+}
+
+void GpioHostTest()
+{
+    Host::GpioPortModel porta(GPIOA);
+    Host::GpioPortModel portb(GPIOB);
+
+    IO::Porta::Set(0x0f);
+    IO::Porta::Clear(0x03);
+    assert(IO::Porta::Read() == 0x0c);
+
+    IO::Porta::Toggle(0x05);
+    assert(IO::Porta::Read() == 0x09);
+
+    using Pins = IO::PinList<IO::Pa0, IO::Pa1, IO::Pb5, IO::Pb6>;
+    Pins::Write(0b1010);
+    Host::RegisterFile::Step();
+    assert((GPIOA->ODR & 0x03) == 0b10);
+    assert((GPIOB->ODR & (0x03 << 5)) == (0b10 << 5));
+    assert(Pins::Read() == 0b1010);
+
+    Pins::WriteByTable(0b0101);
+    Host::RegisterFile::Step();
+    assert((GPIOA->ODR & 0x03) == 0b01);
+    assert((GPIOB->ODR & (0x03 << 5)) == (0b01 << 5));
+    assert(Pins::PinRead() == 0b0101);
+
+    // Bits above pin list width are ignored by both writes, other port pins are kept
+    IO::Porta::Set(0x04);
+    Pins::WriteByTable(0xfa);
+    Host::RegisterFile::Step();
+    assert(Pins::Read() == 0b1010);
+    assert((GPIOA->ODR & 0x04) != 0);
+    Pins::Write(0xf5);
+    Host::RegisterFile::Step();
+    assert(Pins::Read() == 0b0101);
+    assert((GPIOA->ODR & 0x04) != 0);
+    IO::Porta::Clear(0x04);
+
+    // Pins out of order: runs are not merged
+    using Reversed = IO::PinList<IO::Pa3, IO::Pa2, IO::Pb7, IO::Pa4>;
+    Reversed::Write(0b1101);
+    Host::RegisterFile::Step();
+    assert((GPIOA->ODR & (0x07 << 2)) == 0b11000);
+    assert((GPIOB->ODR & (1 << 7)) != 0);
+    assert(Reversed::Read() == 0b1101);
+}
+
+using UartRxTxPins = template_utils::type_list<
+    IO::PinSettings<IO::Pa9, IO::Pa9::Configuration::AltFunc, IO::Pa9::Speed::Fast, uint8_t(7)>,
+    IO::PinSettings<IO::Pa10, IO::Pa10::Configuration::In, IO::Pa10::PullMode::PullUp>>;
+using OpenDrainLeds = IO::PinSettings<IO::PinList<IO::Pa0, IO::Pa1, IO::Pa2, IO::Pa3>,
+    IO::Pa0::Configuration::Out, IO::Pa0::DriverType::OpenDrain, IO::Pa0::Speed::Fast>;
+using ButtonPins = IO::PinSettings<IO::PinList<IO::Pb6, IO::Pb7>, IO::Pb6::Configuration::In, IO::Pb6::PullMode::PullDown>;
+// Pa0 is listed twice with same configuration
+using BoardPins = IO::PinConfiguration<UartRxTxPins, OpenDrainLeds, ButtonPins, IO::PinSettings<IO::Pa0, IO::Pa0::Configuration::Out>>;
+
+void PinConfigurationHostTest()
+{
+    Host::GpioPortModel porta(GPIOA);
+    Host::GpioPortModel portb(GPIOB);
+
+    // Same settings by setter calls
+    IO::Porta::SetConfiguration(IO::Porta::Configuration::AltFunc, 1 << 9);
+    IO::Porta::SetSpeed(IO::Porta::Speed::Fast, 1 << 9);
+    IO::Porta::AltFuncNumber(7, 1 << 9);
+    IO::Porta::SetConfiguration(IO::Porta::Configuration::In, 1 << 10);
+    IO::Porta::SetPullMode(IO::Porta::PullMode::PullUp, 1 << 10);
+    IO::Porta::SetConfiguration(IO::Porta::Configuration::Out, 0x0f);
+    IO::Porta::SetDriverType(IO::Porta::DriverType::OpenDrain, 0x0f);
+    IO::Porta::SetSpeed(IO::Porta::Speed::Fast, 0x0f);
+    IO::Portb::SetConfiguration(IO::Portb::Configuration::In, 0xc0);
+    IO::Portb::SetPullMode(IO::Portb::PullMode::PullDown, 0xc0);
+    Host::RegisterFile::Step();
+    auto snapshot = [](GPIO_TypeDef* regs) {
+#if defined(GPIO_CRL_MODE0)
+        return std::array<uint32_t, 3> {regs->CRL, regs->CRH, regs->ODR};
+#else
+        return std::array<uint32_t, 7> {regs->MODER, regs->OTYPER, regs->OSPEEDR, regs->PUPDR, regs->AFR[0], regs->AFR[1], regs->ODR};
+#endif
+    };
+    const auto expectedA = snapshot(GPIOA);
+    const auto expectedB = snapshot(GPIOB);
+
+    Host::RegisterFile::Reset();
+    static_assert(!BoardPins::HasConflicts());
+    BoardPins::Apply();
+    Host::RegisterFile::Step();
+    assert(snapshot(GPIOA) == expectedA);
+    assert(snapshot(GPIOB) == expectedB);
+}
+
+static volatile bool TransferCompleted = false;
+
+void UsartHostTest()
+{
+    Host::FlagModel status(Host::AddressOf(&Usart1::Regs::Get()->STATUS_REG), Usart1::TxEmptyInt | Usart1::TxCompleteInt | Usart1::RxNotEmptyInt);
+    Host::DmaChannelModel<Usart1::DmaTx> dmaTx;
+
+    Usart1::Init(115200);
+    Usart1::Write("Zhele", 5);
+    assert(Usart1::Regs::Get()->TRANSMIT_DATA_REG == 'e');
+
+    static const char message[] = "Hello from host";
+    TransferCompleted = false;
+    Usart1::WriteAsync(message, sizeof(message), [](void*, unsigned, bool success) { TransferCompleted = success; });
+    Host::RegisterFile::Step();
+    assert(dmaTx.Transferred() == sizeof(message));
+    assert(TransferCompleted);
+    assert(Usart1::WriteReady());
+
+    // Gathered write: header, payload and trailer are sent back-to-back by one DMA submission
+    static const char header[] = "<";
+    static const char trailer[] = ">";
+    static const DmaDescriptor frame[] = {{header, 1}, {message, sizeof(message) - 1}, {trailer, 1}};
+    TransferCompleted = false;
+    Usart1::WriteAsyncList(frame, 3, [](void*, unsigned count, bool success) { TransferCompleted = success && count == 3; });
+    for(unsigned i = 0; i < 3; ++i)
+        Host::RegisterFile::Step();
+    assert(dmaTx.Transferred() == sizeof(message) + sizeof(message) + 1);
+    assert(Usart1::Regs::Get()->TRANSMIT_DATA_REG == '>');
+    assert(TransferCompleted);
+    assert(Usart1::WriteReady());
+}
+
+using UsartStream = UsartRxStream<Usart1, 16>;
+static size_t StreamAvailable = 0;
+
+void UsartStreamHostTest()
+{
+    Host::DmaChannelModel<Usart1::DmaRx> dmaRx(UsartStream::DmaIrqHandler);
+    auto regs = Usart1::Regs::Get();
+
+    auto receive = [&](const char* data) {
+        for(; *data != 0; ++data)
+        {
+            regs->RECEIVE_DATA_REG = *data;
+            dmaRx.Request(1);
+            Host::RegisterFile::Step();
+        }
+    };
+
+    Usart1::Init(115200);
+    UsartStream::Start([](size_t available) { StreamAvailable = available; });
+
+    // Half-transfer event publishes first 8 bytes, tail is published by idle line event
+    receive("Hello, world");
+    assert(StreamAvailable == 8);
+    regs->STATUS_REG |= Usart1::IdleInt;
+    UsartStream::UsartIrqHandler();
+    assert(StreamAvailable == 12 && UsartStream::Available() == 12);
+
+    char buffer[16] {};
+    assert(UsartStream::Read(buffer, 7) == 7);
+    assert(std::memcmp(buffer, "Hello, ", 7) == 0);
+
+    // Wrap around buffer end, region API
+    receive("Zhele!");
+    UsartStream::Publish();
+    assert(UsartStream::Available() == 11);
+    auto region = UsartStream::ReadRegion();
+    assert(region.size() == 9 && std::memcmp(region.data(), "worldZhel", 9) == 0);
+    UsartStream::Consume(region.size());
+    assert(UsartStream::Read(buffer, sizeof(buffer)) == 2 && std::memcmp(buffer, "e!", 2) == 0);
+    assert(!UsartStream::Overrun());
+
+    // Consumer is late
+    receive("0123456789abcdefXYZ");
+    UsartStream::Publish();
+    assert(UsartStream::Overrun());
+    assert(UsartStream::Available() == 0);
+
+    UsartStream::Stop();
+}
+
+using TxQueue = UsartTxQueue<Usart1, 32>;
+
+void UsartTxQueueHostTest()
+{
+    Host::FlagModel status(Host::AddressOf(&Usart1::Regs::Get()->STATUS_REG), Usart1::TxEmptyInt | Usart1::TxCompleteInt);
+    Host::DmaChannelModel<Usart1::DmaTx> dmaTx;
+    Usart1::Init(115200);
+
+    // Write returns immediately, second write doesn't fit into queue
+    assert(TxQueue::Write("0123456789", 10) == 10);
+    assert(!TxQueue::Idle());
+    assert(TxQueue::Write("abcdefghijklmnopqrstuvwxyz", 26) == 22);
+    assert(TxQueue::Rejected() == 4);
+    assert(TxQueue::FreeSpace() == 0);
+
+    // First chunk, then next chunk is started from transfer complete callback
+    Host::RegisterFile::Step();
+    assert(dmaTx.Transferred() == 10);
+    Host::RegisterFile::Step();
+    assert(dmaTx.Transferred() == 32);
+    assert(Usart1::Regs::Get()->TRANSMIT_DATA_REG == 'v');
+    assert(TxQueue::Idle());
+
+    // Idle queue starts DMA from Write
+    assert(TxQueue::Write("Zhele", 5) == 5);
+    assert(TxQueue::Pending() == 5);
+    Host::RegisterFile::Step();
+    assert(dmaTx.Transferred() == 37);
+    assert(TxQueue::Idle());
+}
+
+void SpiHostTest()
+{
+    Host::FlagModel status(Host::AddressOf(&SPI1->SR), SPI_SR_TXE | SPI_SR_RXNE, SPI_SR_BSY);
+
+    Spi1::Init();
+    assert(Spi1::Send(0x5a) == 0x5a);
+    assert(!Spi1::Busy());
+
+    // Data register is loopback in register file
+    const uint8_t transmit[] = "Zhele";
+    uint8_t receive[sizeof(transmit)] {};
+    Spi1::Transfer(transmit, receive, sizeof(transmit));
+    assert(std::memcmp(transmit, receive, sizeof(transmit)) == 0);
+
+    // DMA item size follows frame size set by SetDataSize
+    Spi1::SetDataSize(Spi1::DataSize::DataSize16);
+    Spi1::WriteAsync(transmit, 2);
+    Host::RegisterFile::Step();
+    assert((DMA1_Channel3->CCR & (DMA_CCR_PSIZE | DMA_CCR_MSIZE)) == (DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0));
+    Dma1Channel3::Disable();
+}
+
+void BitBandHostTest()
+{
+    Spi1::Init();
+    Spi1::SetSS();
+    assert(SPI1->CR1 & SPI_CR1_SSI);
+    Spi1::ClearSS();
+    assert(!(SPI1->CR1 & SPI_CR1_SSI));
+    assert(SPI1->CR1 & SPI_CR1_SPE);
+
+    BitBandFlags flags;
+    flags.Set(3);
+    flags.Write(31, true);
+    assert(flags.IsSet(3) && flags.IsSet(31) && !flags.IsSet(4));
+    flags.Clear(3);
+    assert(flags.Get() == 0x80000000);
+}
+
+/**
+ * @brief Wire between two pins of one port (IDR of input pin follows ODR of output pin)
+ *
+ * @tparam _From Output pin
+ * @tparam _To Input pin
+ */
+template<typename _From, typename _To>
+class WireModel : public Host::PeripheralModel
+{
+public:
+    WireModel(GPIO_TypeDef* regs)
+        : _regs(regs)
+    {
+        Host::RegisterFile::Attach(*this, Host::AddressOf(regs), sizeof(GPIO_TypeDef));
+    }
+
+    ~WireModel() override
+    {
+        Host::RegisterFile::Detach(*this);
+    }
+
+    void Step() override
+    {
+        bool level = _regs->ODR & (1u << _From::Number);
+        _regs->IDR = (_regs->IDR & ~(1u << _To::Number)) | (uint32_t(level) << _To::Number);
+    }
+
+private:
+    GPIO_TypeDef* _regs;
+};
+
+void DelayHostTest()
+{
+    Host::CycleCounterModel cycles;
+
+    // Counter is enabled by first delay
+    uint64_t start = cycles.Cycles();
+    delay_us<10, 72000000>();
+    uint64_t elapsed = cycles.Cycles() - start;
+    assert(elapsed >= 720 && elapsed < 720 + 32);
+
+    start = cycles.Cycles();
+    delay_ns<500, 72000000>();
+    elapsed = cycles.Cycles() - start;
+    assert(elapsed >= 36 && elapsed < 36 + 32);
+
+    CycleCounter::Ticks measured = 0;
+    {
+        ScopedCycles measure(measured);
+        delay_us<2, 72000000>();
+    }
+    assert(measured >= 144 && measured < 144 + 32);
+}
+
+#if !defined(DWT_CTRL_CYCCNTENA_Msk)
+void CycleCounterSysTickHostTest()
+{
+    Host::CycleCounterModel cycles;
+
+    // System tick timer (1 kHz at 72 MHz) is kept, intervals are counted modulo its period
+    constexpr uint32_t control = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    SysTick->LOAD = 72000 - 1;
+    SysTick->VAL = 100;
+    SysTick->CTRL = control;
+    CycleCounter::Enable();
+    assert(SysTick->CTRL == control && SysTick->LOAD == 72000 - 1);
+
+    uint64_t start = cycles.Cycles();
+    CycleCounter::Delay(50000);
+    uint64_t elapsed = cycles.Cycles() - start;
+    assert(elapsed >= 50000 && elapsed < 50000 + 32);
+
+    // Edges across counter reload
+    CycleCounter::Ticks edge = CycleCounter::Now();
+    start = cycles.Cycles();
+    for(unsigned i = 0; i < 10; ++i)
+        CycleCounter::WaitPeriod(edge, 10000);
+    elapsed = cycles.Cycles() - start;
+    assert(elapsed >= 100000 && elapsed < 100000 + 32);
+
+    // HCLK/8 clock: delay is counted in cycles (rounded up to tick), not in ticks
+    SysTick->CTRL = SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    start = cycles.Cycles();
+    delay_us<10, 72000000>();
+    elapsed = cycles.Cycles() - start;
+    assert(elapsed >= 720 && elapsed < 720 + 32);
+    assert(SysTick->CTRL == (SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk));
+}
+#endif
+
+void SoftSpiHostTest()
+{
+    // Port model is attached before wire, so wire sees ODR with applied BSRR
+    Host::GpioPortModel porta(GPIOA);
+    WireModel<IO::Pa7, IO::Pa6> loopback(GPIOA);
+    Host::CycleCounterModel cycles;
+    using Spi = SoftSpi<IO::Pa7, IO::Pa6, IO::Pa5, IO::Pa4, 72000000>;
+
+    Spi::Init(Spi::Div16);
+    assert(Spi::Send(0xa5) == 0xa5);
+    Host::RegisterFile::Step();
+    assert(!(GPIOA->ODR & (1 << 5)));
+
+    // Each bit takes at least one clock period (16 cycles)
+    uint64_t start = cycles.Cycles();
+    Spi::Send(0x5a);
+    assert(cycles.Cycles() - start >= 8 * 16);
+
+    Spi::SetClockPolarity(Spi::ClockPolarityHigh);
+    Spi::SetClockPhase(Spi::ClockPhaseFallingEdge);
+    Spi::SetBitOrder(Spi::LsbFirst);
+    Spi::SetDataSize(Spi::DataSize16);
+    assert(Spi::Send(0x1234) == 0x1234);
+    Host::RegisterFile::Step();
+    assert(GPIOA->ODR & (1 << 5));
+
+    Spi::ClearSS();
+    Host::RegisterFile::Step();
+    assert(!(GPIOA->ODR & (1 << 4)));
+    Spi::SetSS();
+    Host::RegisterFile::Step();
+    assert(GPIOA->ODR & (1 << 4));
+}
+
+void SoftI2cHostTest()
+{
+    Host::GpioPortModel portb(GPIOB);
+    Host::I2cPinsDeviceModel<IO::Pb6, IO::Pb7> device(0x50);
+    Host::CycleCounterModel cycles;
+    using I2c = SoftI2c<IO::Pb6, IO::Pb7, 72000000>;
+
+    I2c::Init<400000>();
+    const uint8_t data[] = {'Z', 'h', 'e'};
+    assert(I2c::Write(0x50, 0x10, data, sizeof(data)) == I2cStatus::Success);
+    assert(std::memcmp(&device.Memory[0x10], data, sizeof(data)) == 0);
+
+    uint8_t read[sizeof(data)] {};
+    assert(I2c::Read(0x50, 0x10, read, sizeof(read)) == I2cStatus::Success);
+    assert(std::memcmp(read, data, sizeof(data)) == 0);
+    assert(I2c::ReadU8(0x50, 0x11).Value == 'h');
+
+    // Nobody acknowledges other address
+    assert(I2c::WriteU8(0x51, 0x10, 0x42) == I2cStatus::Nack);
+    assert(!I2c::Busy());
+    // Two writes and two reads (each one with repeated start)
+    assert(device.Starts() == 6);
+
+    // SCL held low by "slave"
+    IO::Portb::Clear(1 << 6);
+    assert(I2c::Busy());
+    assert(I2c::WriteU8(0x50, 0x10, 0x42) == I2cStatus::Busy);
+}
+
+/// Chip select change (with SPI clock divider at that moment)
+struct ChipSelectEvent
+{
+    unsigned Id;
+    bool Selected;
+    uint32_t Divider;
+
+    bool operator==(const ChipSelectEvent&) const = default;
+};
+std::array<ChipSelectEvent, 8> ChipSelectLog;
+unsigned ChipSelectLogSize = 0;
+
+/// Chip select stub (records state instead of GPIO write)
+template<unsigned _Id>
+struct ChipSelectStub
+{
+    static void Set() { Selected = false; Record(); }
+    static void Clear() { Selected = true; ++Selections; Record(); }
+    static void Record() { ChipSelectLog[ChipSelectLogSize++] = {_Id, Selected, SPI1->CR1 & SPI_CR1_BR}; }
+    static inline bool Selected = false;
+    static inline unsigned Selections = 0;
+};
+
+using Bus = SpiBus<Spi1, 4>;
+using DeviceA = SpiBusDevice<Bus, ChipSelectStub<0>, Spi1::Fast>;
+using DeviceB = SpiBusDevice<Bus, ChipSelectStub<1>, Spi1::Slow, Spi1::ClockPolarityHigh, Spi1::ClockPhaseFallingEdge>;
+
+void SpiBusHostTest()
+{
+    Host::FlagModel status(Host::AddressOf(&SPI1->SR), SPI_SR_TXE | SPI_SR_RXNE, SPI_SR_BSY);
+    Host::DmaChannelModel<Spi1::DmaTx> dmaTx;
+    // Transaction is completed by RX DMA: test releases received frames transaction by transaction
+    Host::DmaChannelModel<Spi1::DmaRx> dmaRx;
+    Spi1::Init();
+
+    struct Log
+    {
+        void OnComplete(bool success) { ++Count; Success = Success && success; }
+        unsigned Count = 0;
+        bool Success = true;
+    } log;
+    auto callback = SpiBusTransaction::Callback::Bind<&Log::OnComplete>(log);
+
+    const uint8_t command[] = {0x12, 0x34};
+    uint8_t response[2] {};
+
+    // Command and response of device A in one chip select, then device B
+    assert(DeviceA::Write(command, sizeof(command), callback, true));
+    assert(DeviceA::Read(response, sizeof(response), callback, true));
+    assert(DeviceB::Write(command, sizeof(command), callback));
+    assert(Bus::Pending() == 3);
+    assert(ChipSelectStub<0>::Selected && !ChipSelectStub<1>::Selected);
+    assert((SPI1->CR1 & SPI_CR1_BR) == Spi1::Fast);
+
+    // One transaction per DMA completion, next one is started from interrupt
+    dmaRx.Request(2);
+    Host::RegisterFile::Step();
+    assert(log.Count == 1 && ChipSelectStub<0>::Selected);
+    dmaRx.Request(2);
+    Host::RegisterFile::Step();
+    assert(log.Count == 2 && !ChipSelectStub<0>::Selected && ChipSelectStub<1>::Selected);
+    assert((SPI1->CR1 & SPI_CR1_BR) == Spi1::Slow);
+    assert(SPI1->CR1 & SPI_CR1_CPOL);
+    dmaRx.Request(2);
+    Host::RegisterFile::Step();
+    assert(log.Count == 3 && log.Success);
+    assert(!ChipSelectStub<1>::Selected);
+    assert(Bus::Idle());
+
+    assert(ChipSelectStub<0>::Selections == 1 && ChipSelectStub<1>::Selections == 1);
+    assert(dmaTx.Transferred() == 6 && dmaRx.Transferred() == 6);
+
+    // Kept selected device is released before clock is reconfigured for next device,
+    // next device is selected after that
+    const ChipSelectEvent expected[] = {
+        {0, true, Spi1::Fast}, {0, false, Spi1::Fast}, {1, true, Spi1::Slow}, {1, false, Spi1::Slow}};
+    assert(ChipSelectLogSize == std::size(expected));
+    assert(std::equal(std::begin(expected), std::end(expected), ChipSelectLog.begin()));
+}
+
+#if defined(I2C_SR2_BUSY)
+void I2cHostTest()
+{
+    // Paced DMA models, RX DMA completion interrupt is raised like I2C interrupts
+    Host::DmaChannelModel<I2c1::DmaTx> dmaTx(I2c1::DmaTx::IrqHandler, true);
+    Host::DmaChannelModel<I2c1::DmaRx> dmaRx([] { Host::RegisterFile::Raise(I2c1::DmaRx::IrqHandler); }, true);
+    Host::I2cDeviceModel<I2c1> device(0x50, 9, &dmaTx, &dmaRx);
+    I2c1::Init();
+
+    struct Log
+    {
+        void OnComplete(I2cStatus status) { Statuses[Count++] = status; }
+        I2cStatus Statuses[5];
+        unsigned Count = 0;
+    } log;
+    auto callback = I2cCallback::Bind<&Log::OnComplete>(log);
+
+    const uint8_t write[] = {0x10, 'Z', 'h', 'e'}; // Register address and data
+    const uint8_t regAddr = 0x10;
+    uint8_t read[3] {};
+    uint8_t pair[2] {};
+    uint8_t single = 0;
+
+    assert(I2c1::Enqueue({.DevAddr = 0x50, .WriteBuffer = write, .WriteSize = sizeof(write), .OnComplete = callback}));
+    assert(I2c1::Enqueue({.DevAddr = 0x50, .WriteBuffer = &regAddr, .WriteSize = 1, .ReadBuffer = read, .ReadSize = sizeof(read), .OnComplete = callback}));
+    assert(I2c1::Enqueue({.DevAddr = 0x51, .WriteBuffer = write, .WriteSize = sizeof(write), .OnComplete = callback}));
+    // Two bytes are read without DMA (POS), next read checks that POS is cleared
+    assert(I2c1::Enqueue({.DevAddr = 0x50, .WriteBuffer = &regAddr, .WriteSize = 1, .ReadBuffer = pair, .ReadSize = sizeof(pair), .OnComplete = callback}));
+    assert(I2c1::Enqueue({.DevAddr = 0x50, .WriteBuffer = &regAddr, .WriteSize = 1, .ReadBuffer = &single, .ReadSize = 1, .OnComplete = callback}));
+    assert(I2c1::Pending() == 5);
+
+    // Main code only waits, transactions are driven by interrupts
+    for(unsigned i = 0; i < 2000 && !I2c1::Idle(); ++i)
+        Host::RegisterFile::Step();
+    assert(I2c1::Idle() && log.Count == 5);
+    assert(log.Statuses[0] == I2cStatus::Success && log.Statuses[1] == I2cStatus::Success);
+    assert(log.Statuses[2] == I2cStatus::Nack && log.Statuses[3] == I2cStatus::Success);
+    assert(log.Statuses[4] == I2cStatus::Success);
+    assert(std::memcmp(&device.Memory[0x10], "Zhe", 3) == 0);
+    assert(std::memcmp(read, "Zhe", 3) == 0);
+    assert(std::memcmp(pair, "Zh", 2) == 0);
+    assert(single == 'Z');
+    assert(!(I2C1->CR1 & I2C_CR1_POS));
+
+    // Blocking API works with the same model
+    uint8_t blocking[3] {};
+    assert(I2c1::Read(0x50, 0x10, blocking, sizeof(blocking)) == I2cStatus::Success);
+    assert(std::memcmp(blocking, "Zhe", 3) == 0);
+}
+#endif
+
+#if defined(I2C_ISR_TCR)
+void I2cReloadHostTest()
+{
+#if defined(DMAMUX1)
+    // I2C has no DMA channels on families with DMAMUX: interrupts move data
+    using I2c = I2c1NoDma;
+    Host::I2cDeviceModel<I2c> device(0x50);
+#else
+    using I2c = I2c1;
+    Host::DmaChannelModel<I2c::DmaTx> dmaTx(I2c::DmaTx::IrqHandler, true);
+    Host::DmaChannelModel<I2c::DmaRx> dmaRx(I2c::DmaRx::IrqHandler, true);
+    Host::I2cDeviceModel<I2c> device(0x50, 9, &dmaTx, &dmaRx);
+#endif
+    I2c::Init();
+
+    struct Log
+    {
+        void OnComplete(I2cStatus status) { Statuses[Count++] = status; }
+        I2cStatus Statuses[4];
+        unsigned Count = 0;
+    } log;
+    auto callback = I2cCallback::Bind<&Log::OnComplete>(log);
+
+    // Phases longer than 255 bytes are transferred by NBYTES chunks (RELOAD, TCR)
+    static uint8_t write[300];
+    static uint8_t read[300];
+    for(unsigned i = 0; i < sizeof(write); ++i)
+        write[i] = static_cast<uint8_t>(i * 7 + 1);
+    write[0] = 0x00; // Memory pointer
+    const uint8_t regAddr = 0x10;
+    uint8_t small[3] {};
+
+    assert(I2c::Enqueue({.DevAddr = 0x50, .WriteBuffer = write, .WriteSize = sizeof(write), .OnComplete = callback}));
+    assert(I2c::Enqueue({.DevAddr = 0x50, .WriteBuffer = write, .WriteSize = 1, .ReadBuffer = read, .ReadSize = sizeof(read), .OnComplete = callback}));
+    assert(I2c::Enqueue({.DevAddr = 0x51, .WriteBuffer = write, .WriteSize = sizeof(write), .OnComplete = callback}));
+    assert(I2c::Enqueue({.DevAddr = 0x50, .WriteBuffer = &regAddr, .WriteSize = 1, .ReadBuffer = small, .ReadSize = sizeof(small), .OnComplete = callback}));
+
+    for(unsigned i = 0; i < 20000 && !I2c::Idle(); ++i)
+        Host::RegisterFile::Step();
+    assert(I2c::Idle() && log.Count == 4);
+    assert(log.Statuses[0] == I2cStatus::Success && log.Statuses[1] == I2cStatus::Success);
+    assert(log.Statuses[2] == I2cStatus::Nack && log.Statuses[3] == I2cStatus::Success);
+
+    // Memory pointer wraps, last 256 bytes are in memory
+    for(unsigned i = sizeof(write) - 256; i < sizeof(write); ++i)
+        assert(device.Memory[(i - 1) & 0xff] == write[i]);
+    for(unsigned i = 0; i < sizeof(read); ++i)
+        assert(read[i] == device.Memory[i & 0xff]);
+    assert(std::memcmp(small, &device.Memory[0x10], sizeof(small)) == 0);
+}
+#endif
+
+void DmaHostTest()
+{
+#if defined (DMA1_Stream0)
+    using DmaCh = Dma2Stream0;
+#else
+    using DmaCh = Dma1Channel1;
+#endif
+    Host::DmaChannelModel<DmaCh> model;
+
+    uint32_t source[16];
+    uint32_t destination[16] {};
+    for(unsigned i = 0; i < 16; ++i)
+        source[i] = i * 0x01010101;
+
+    DmaCh::Transfer(DmaCh::Mem2Mem | DmaCh::MemIncrement | DmaCh::PeriphIncrement | DmaCh::MSize32Bits | DmaCh::PSize32Bits,
+        destination, source, 16);
+    Host::RegisterFile::Step();
+
+    assert(DmaCh::TransferComplete());
+    assert(DmaCh::RemainingTransfers() == 0);
+    assert(std::memcmp(source, destination, sizeof(source)) == 0);
+
+    // Stateful completion handler (delegate with bound object)
+    struct Completion
+    {
+        void OnTransfer(void*, unsigned size, bool success) { Size = size; Success = success; ++Calls; }
+        unsigned Calls = 0;
+        unsigned Size = 0;
+        bool Success = false;
+    } completion;
+    DmaCh::SetTransferCallback(DmaChannelData::TransferCallback::Bind<&Completion::OnTransfer>(completion));
+    DmaCh::Transfer(DmaCh::Mem2Mem | DmaCh::MemIncrement | DmaCh::PeriphIncrement | DmaCh::MSize32Bits | DmaCh::PSize32Bits,
+        destination, source, 8);
+    Host::RegisterFile::Step();
+
+    assert(completion.Calls == 1 && completion.Size == 8 && completion.Success);
+
+    // Scattered transfer: one source block to two destination blocks, single callback for whole list
+    std::memset(destination, 0, sizeof(destination));
+    const DmaReceiveDescriptor descriptors[] = {{&destination[0], 4}, {&destination[8], 4}};
+    completion.Calls = 0;
+    DmaCh::TransferList(DmaCh::Mem2Mem | DmaCh::MemIncrement | DmaCh::PeriphIncrement | DmaCh::MSize32Bits | DmaCh::PSize32Bits,
+        descriptors, 2, source);
+    Host::RegisterFile::Step();
+    Host::RegisterFile::Step();
+
+    assert(completion.Calls == 1 && completion.Size == 2 && completion.Success);
+    assert(DmaCh::CurrentDescriptor() == 1);
+    assert(std::memcmp(&destination[0], source, 4 * sizeof(uint32_t)) == 0);
+    assert(std::memcmp(&destination[8], source, 4 * sizeof(uint32_t)) == 0);
+    assert(destination[4] == 0 && destination[7] == 0 && destination[12] == 0);
+
+    // Empty descriptors are skipped (zero items count never raises transfer complete)
+    std::memset(destination, 0, sizeof(destination));
+    const DmaReceiveDescriptor sparse[] = {{&destination[0], 0}, {&destination[2], 2}, {&destination[6], 0}, {&destination[8], 2}, {&destination[12], 0}};
+    completion.Calls = 0;
+    DmaCh::TransferList(DmaCh::Mem2Mem | DmaCh::MemIncrement | DmaCh::PeriphIncrement | DmaCh::MSize32Bits | DmaCh::PSize32Bits,
+        sparse, 5, source);
+    Host::RegisterFile::Step();
+    Host::RegisterFile::Step();
+
+    assert(completion.Calls == 1 && completion.Size == 5 && completion.Success);
+    assert(DmaCh::CurrentDescriptor() == 3);
+    assert(destination[2] == source[0] && destination[3] == source[1]);
+    assert(destination[8] == source[0] && destination[9] == source[1]);
+    assert(destination[0] == 0 && destination[4] == 0 && destination[10] == 0);
+
+    // List without data completes at once
+    completion.Calls = 0;
+    DmaCh::TransferList(DmaCh::Mem2Mem | DmaCh::MemIncrement | DmaCh::PeriphIncrement | DmaCh::MSize32Bits | DmaCh::PSize32Bits,
+        sparse, 1, source);
+    assert(completion.Calls == 1 && completion.Success);
+    DmaCh::SetTransferCallback(nullptr);
+}
+
+static unsigned MemoryCompletions = 0;
+
+void DmaMemoryHostTest()
+{
+#if defined (DMA1_Stream0)
+    using DmaCh = Dma2Stream0;
+#else
+    using DmaCh = Dma1Channel1;
+#endif
+    using Memory = DmaMemory<DmaCh, 32>;
+    Host::DmaChannelModel<DmaCh> model;
+
+    alignas(4) static uint8_t source[300];
+    alignas(4) static uint8_t destination[304];
+    for(unsigned i = 0; i < sizeof(source); ++i)
+        source[i] = i * 7;
+    auto completed = [](bool success) { if(success) ++MemoryCompletions; };
+
+    // Small block is copied by CPU before return
+    assert(Memory::Copy(destination, source, 16, completed));
+    assert(MemoryCompletions == 1 && !Memory::Busy());
+    assert(std::memcmp(destination, source, 16) == 0);
+
+    // Unaligned block (byte items)
+    assert(Memory::Copy(destination + 1, source + 3, 257, completed));
+    assert(Memory::Busy());
+    assert(!Memory::Copy(destination, source, 64)); // DMA is busy
+    while(Memory::Busy())
+        Host::RegisterFile::Step();
+    assert(MemoryCompletions == 2);
+    assert(std::memcmp(destination + 1, source + 3, 257) == 0);
+
+    // Aligned fill (word items), bytes after block are untouched
+    destination[256] = 0;
+    assert(Memory::Fill(destination, 0xa5, 256, completed));
+    while(Memory::Busy())
+        Host::RegisterFile::Step();
+    assert(MemoryCompletions == 3);
+    assert(destination[0] == 0xa5 && destination[127] == 0xa5 && destination[255] == 0xa5 && destination[256] == 0);
+    DmaCh::SetTransferCallback(nullptr);
+}
+
+#if defined(DMA_SxCR_DBM)
+static void* CompletedBuffer = nullptr;
+static bool TransferFailed = false;
+
+/**
+ * @brief Peripheral that requests DMA items on next access to stream registers
+ *
+ * @tparam _DmaChannel DMA stream
+ */
+template<typename _DmaChannel>
+class DmaRequestModel : public Host::PeripheralModel
+{
+public:
+    DmaRequestModel(Host::DmaChannelModel<_DmaChannel>& dma)
+        : _dma(dma)
+    {
+        Host::RegisterFile::Attach(*this, Host::AddressOf(_DmaChannel::Regs::Get()), sizeof(typename _DmaChannel::Regs::DataT));
+    }
+
+    ~DmaRequestModel() override
+    {
+        Host::RegisterFile::Detach(*this);
+    }
+
+    void Request(uint32_t count)
+    {
+        _requests = count;
+    }
+
+    void Step() override
+    {
+        _dma.Request(_requests);
+        _requests = 0;
+    }
+
+private:
+    Host::DmaChannelModel<_DmaChannel>& _dma;
+    uint32_t _requests = 0;
+};
+
+void DmaDoubleBufferHostTest()
+{
+    using DmaCh = Dma2Stream0;
+    Host::DmaChannelModel<DmaCh> model;
+
+    static volatile uint16_t sample = 0;
+    uint16_t buffer0[4] {};
+    uint16_t buffer1[4] {};
+    uint16_t buffer2[4] {};
+    auto filledWith = [](const uint16_t* buffer, uint16_t value) {
+        return buffer[0] == value && buffer[1] == value && buffer[2] == value && buffer[3] == value;
+    };
+
+    DmaCh::SetTransferCallback([](void* data, unsigned, bool success) { if(success) CompletedBuffer = data; });
+    DmaCh::TransferDoubleBuffer(DmaCh::Periph2Mem | DmaCh::MemIncrement | DmaCh::MSize16Bits | DmaCh::PSize16Bits,
+        buffer0, buffer1, &sample, 4);
+    assert(DmaCh::IdleBufferIndex() == 1 && DmaCh::IdleBuffer() == buffer1);
+
+    sample = 1;
+    model.Request(4);
+    Host::RegisterFile::Step();
+    assert(CompletedBuffer == buffer0 && filledWith(buffer0, 1));
+    assert(DmaCh::IdleBufferIndex() == 0);
+
+    // Consumer hands buffer0 over and gives fresh buffer2 instead
+    assert(DmaCh::SetIdleBuffer(buffer2));
+
+    sample = 2;
+    model.Request(4);
+    Host::RegisterFile::Step();
+    assert(CompletedBuffer == buffer1 && filledWith(buffer1, 2));
+
+    sample = 3;
+    model.Request(4);
+    Host::RegisterFile::Step();
+    assert(CompletedBuffer == buffer2 && filledWith(buffer2, 3));
+    assert(filledWith(buffer0, 1));
+    assert(DmaCh::Enabled());
+
+    // DMA completes buffer1 while consumer replaces idle buffer2: new address hits register in use
+    {
+        DmaRequestModel<DmaCh> peripheral(model);
+        DmaCh::SetTransferCallback([](void* data, unsigned, bool success) { if(success) CompletedBuffer = data; else TransferFailed = true; });
+
+        sample = 4;
+        peripheral.Request(4);
+        assert(!DmaCh::SetIdleBuffer(buffer0));
+        assert(CompletedBuffer == buffer1 && filledWith(buffer1, 4));
+        assert(TransferFailed && !DmaCh::Enabled());
+    }
+
+    DmaCh::Disable();
+    DmaCh::SetTransferCallback(nullptr);
+}
+#endif
+
+void TimerDmaBurstHostTest()
+{
+#if defined (DMA1_Stream0)
+    using DmaCh = Dma1Stream2;
+#else
+    using DmaCh = Dma1Channel3;
+#endif
+    using Burst = Timers::Timer3::DmaBurst<DmaCh>;
+    Host::DmaChannelModel<DmaCh> dma(DmaCh::IrqHandler, true);
+
+    // Duty of four channels for three periods
+    static const uint16_t duty[3][4] = {{10, 20, 30, 40}, {20, 30, 40, 50}, {0, 0, 0, 0}};
+    assert(Burst::Start(Timers::Timer3::BurstRegister::CCR1, 4, &duty[0][0], 3));
+    assert(TIM3->DCR == ((3u << TIM_DCR_DBL_Pos) | ((offsetof(TIM_TypeDef, CCR1) / 4) << TIM_DCR_DBA_Pos)));
+    assert(TIM3->DIER & TIM_DIER_UDE);
+    assert(DmaCh::PeriphAddress() == &TIM3->DMAR);
+    assert(DmaCh::RemainingTransfers() == 12);
+
+    // Each update event requests burst of four transfers
+    for(unsigned i = 0; i < 3; ++i)
+    {
+        assert(!Burst::Done());
+        dma.Request(4);
+        Host::RegisterFile::Step();
+    }
+    assert(dma.Transferred() == 12);
+    assert(Burst::Done());
+
+    Burst::Stop();
+    assert(!(TIM3->DIER & TIM_DIER_UDE));
+    assert(!DmaCh::Enabled());
+
+    // Table longer than DMA counter (18 * 4000 items) is rejected
+    assert(!Burst::Start(Timers::Timer3::BurstRegister::CCR1, 18, &duty[0][0], 4000));
+    assert(!(TIM3->DIER & TIM_DIER_UDE) && !DmaCh::Enabled());
+}
+
+#if defined (DMA1_Stream0)
+using CaptureDma = Dma1Stream4;
+#else
+using CaptureDma = Dma1Channel6;
+#endif
+using TestReceiver = Timers::PulseCapture<Timers::Timer3, CaptureDma, 128>;
+static uint16_t NecCommand = 0;
+
+static void CaptureEdge(Host::TimerModel& timer, Host::DmaChannelModel<CaptureDma>& dma, uint32_t ticks)
+{
+    timer.Advance(ticks);
+    dma.Request(1);
+    timer.Capture(0);
+}
+
+void PulseCaptureHostTest()
+{
+    {
+        using Capture = Timers::Timer3::InputCapture<0>::DmaCapture<CaptureDma>;
+        Host::DmaChannelModel<CaptureDma> dma;
+        static uint16_t edges[4];
+        Capture::Start(edges, 4);
+        assert(TIM3->DIER & TIM_DIER_CC1DE);
+        assert(CaptureDma::PeriphAddress() == &TIM3->CCR1);
+
+        // Circular buffer: fifth value overwrites the first one
+        for(uint16_t i = 1; i <= 5; ++i)
+        {
+            TIM3->CCR1 = i * 100;
+            dma.Request(1);
+            Host::RegisterFile::Step();
+        }
+        assert(Capture::Position() == 1);
+        assert(edges[0] == 500 && edges[1] == 200 && edges[3] == 400);
+
+        Capture::Stop();
+        assert(!(TIM3->DIER & TIM_DIER_CC1DE));
+    }
+
+    Host::TimerModel timer(TIM3, TestReceiver::IRQHandler);
+    Host::DmaChannelModel<CaptureDma> dma;
+    TestReceiver::Init(1000000, 10000);
+    Drivers::NecDecoder::SetCallback([](Drivers::NecDecoder::Command command) { NecCommand = command; });
+
+    // NEC frame (address 0x10, command 0x45): start mark and space, 32 bits, final mark
+    const uint32_t frame = 0x10 | (0xef << 8) | (0x45 << 16) | (0xbau << 24);
+    uint32_t interrupts = timer.Interrupts();
+    CaptureEdge(timer, dma, 20000);
+    CaptureEdge(timer, dma, 9000);
+    CaptureEdge(timer, dma, 4500);
+    for(unsigned bit = 0; bit < 32; ++bit)
+    {
+        CaptureEdge(timer, dma, 562);
+        CaptureEdge(timer, dma, (frame & (1u << bit)) ? 1687 : 562);
+    }
+    CaptureEdge(timer, dma, 562);
+    TestReceiver::Frame received;
+    assert(!TestReceiver::ReadFrame(received));
+
+    // Silence ends frame: two interrupts (first edge and gap) for 68 edges
+    timer.Advance(20000);
+    assert(timer.Interrupts() - interrupts == 2);
+    assert(TestReceiver::ReadFrame(received));
+    assert(received.Size() == 67);
+    assert(received[0] == 9000 && received[66] == 562);
+    assert(Drivers::NecDecoder::Decode(received));
+    assert(NecCommand == 0xbaef);
+    assert(!TestReceiver::ReadFrame(received));
+
+    // Repeat code is not decoded as command
+    for(uint32_t interval : {20000u, 9000u, 2250u, 562u})
+        CaptureEdge(timer, dma, interval);
+    timer.Advance(20000);
+    assert(timer.Interrupts() - interrupts == 4);
+    assert(TestReceiver::ReadFrame(received));
+    assert(received.Size() == 3 && !Drivers::NecDecoder::Decode(received));
+    assert(TestReceiver::DroppedFrames() == 0);
+}
+
+using TestWheel = Timers::TimerWheel<Timers::Timer3>;
+static uint32_t WheelFired[3] {};
+
+void TimerWheelHostTest()
+{
+    Host::TimerModel timer(TIM3, TestWheel::IRQHandler);
+    TestWheel::Init(1000);
+
+    static Timers::SoftTimer once([] { WheelFired[0] = TestWheel::Now(); });
+    static Timers::SoftTimer periodic([] { ++WheelFired[1]; });
+    static Timers::SoftTimer far([] { WheelFired[2] = TestWheel::Now(); });
+    static Timers::SoftTimer cancelled([] { assert(false); });
+    TestWheel::Start(once, 10);
+    TestWheel::Start(periodic, 5, 100);
+    TestWheel::Start(far, 200000);
+    TestWheel::Start(cancelled, 50);
+    TestWheel::Cancel(cancelled);
+    assert(TestWheel::NextExpiryDelay() == 5);
+
+    timer.Advance(1000);
+    assert(WheelFired[0] == 10);
+    assert(WheelFired[1] == 10);
+    assert(!once.IsActive() && periodic.IsActive() && far.IsActive() && !cancelled.IsActive());
+
+    // Far timer is cascaded through all levels, counter wraps a few times meanwhile
+    TestWheel::Cancel(periodic);
+    timer.Advance(200000);
+    assert(WheelFired[1] == 10);
+    assert(WheelFired[2] == 200000);
+    assert(TestWheel::Now() == 201000);
+    assert(TestWheel::NextExpiryDelay() == std::numeric_limits<TestWheel::Ticks>::max());
+}
+
+using TestClock = Timers::MonotonicClock<Timers::Timer3, 1>;
+
+void MonotonicClockHostTest()
+{
+    {
+        Host::TimerModel timer(TIM3, TestClock::IRQHandler);
+        TestClock::Init(1000000);
+        assert(TestClock::Now() == 0);
+
+        // Reads just before, at and after each half period boundary
+        for(unsigned i = 0; i < 1000; ++i)
+        {
+            for(uint32_t step : {0x7fffu, 1u, 1u, 0x7ffdu, 1u, 12345u})
+            {
+                timer.Advance(step);
+                assert(TestClock::Now() == timer.Ticks());
+            }
+        }
+        assert(TestClock::NowNs() == TestClock::ToNanoseconds(timer.Ticks()));
+        assert(TestClock::ToNanoseconds(1500000) == 1500000000ull);
+    }
+
+    // Handler is late (or preempted by reader): boundary event is pending while clock is read
+    Host::TimerModel timer(TIM3);
+    TestClock::Init(1000000);
+    for(unsigned i = 0; i < 10000; ++i)
+    {
+        timer.Advance(1 + (i * 7919u) % 0x7fffu);
+        assert(TestClock::Now() == timer.Ticks());
+        TestClock::IRQHandler();
+        assert(TestClock::Now() == timer.Ticks());
+    }
+}
+
+using TestIdle = Timers::TicklessIdle<TestWheel>;
+static Host::TimerModel* IdleTimer = nullptr;
+static uint32_t IdleDeadline = 0;
+static bool IdleWakeup = false;
+
+void TicklessIdleHostTest()
+{
+    Host::TimerModel timer(TIM3, TestWheel::IRQHandler);
+    IdleTimer = &timer;
+    // Core sleeps until next timer event
+    Host::RegisterFile::SetWaitHandler([] { return IdleTimer->AdvanceToEvent(std::numeric_limits<uint64_t>::max()) != 0; });
+    TestWheel::Init(1000);
+
+    static Timers::SoftTimer deadline([] { IdleDeadline = TestWheel::Now(); });
+    TestWheel::Start(deadline, 300);
+    assert(TestIdle::Enter([] { return true; }) == TestIdle::Mode::Busy);
+    assert(timer.Ticks() == 0);
+
+    // One wake-up exactly at deadline, no tick interrupts
+    uint32_t interrupts = timer.Interrupts();
+    assert(TestIdle::Enter() == TestIdle::Mode::Sleep);
+    assert(IdleDeadline == 300 && timer.Ticks() == 300);
+    assert(timer.Interrupts() - interrupts == 1);
+
+    // Stop is not enabled: empty wheel sleeps until its keep-alive compare
+    assert(TestIdle::Enter() == TestIdle::Mode::Sleep);
+    assert(timer.Ticks() > 300);
+
+#if defined(RCC_CR_PLLON)
+    // Stop mode: timer is stopped, external interrupt wakes core up on HSI
+    Host::RccModel rcc;
+    RCC->CR = RCC_CR_HSION | RCC_CR_PLLON;
+    RCC->CFGR = RCC_CFGR_SW_PLL;
+    Host::RegisterFile::Step();
+    Host::RegisterFile::SetWaitHandler([] {
+        assert(SCB->SCR & SCB_SCR_SLEEPDEEP_Msk);
+    #if defined(PWR_CR_LPDS)
+        assert((PWR->CR & (PWR_CR_LPDS | PWR_CR_PDDS)) == PWR_CR_LPDS);
+    #endif
+        RCC->CR &= ~(RCC_CR_PLLON | RCC_CR_PLLRDY);
+        RCC->CFGR &= ~(RCC_CFGR_SW | RCC_CFGR_SWS);
+        Host::RegisterFile::Raise([] { IdleWakeup = true; });
+        Host::RegisterFile::Step();
+        return true;
+    });
+
+    TestIdle::EnableStop();
+    uint64_t ticks = timer.Ticks();
+    assert(TestIdle::Enter() == TestIdle::Mode::Stop);
+    assert(IdleWakeup && timer.Ticks() == ticks);
+    assert(!(SCB->SCR & SCB_SCR_SLEEPDEEP_Msk));
+    assert(RCC->CR & RCC_CR_PLLRDY);
+    Host::RegisterFile::Step();
+    assert((RCC->CFGR & RCC_CFGR_SWS) == RCC_CFGR_SWS_PLL);
+
+    // Pending deadline forbids Stop (timer clock would be stopped)
+    TestWheel::Start(deadline, 10);
+    Host::RegisterFile::SetWaitHandler([] { return IdleTimer->AdvanceToEvent(std::numeric_limits<uint64_t>::max()) != 0; });
+    assert(TestIdle::Enter() == TestIdle::Mode::Sleep);
+    assert(IdleDeadline == TestWheel::Now());
+    TestIdle::DisableStop();
+#endif
+
+    Host::RegisterFile::SetWaitHandler(nullptr);
+}
+
+using Host::AccessCounters;
+using Host::AccessTrace;
+
+void PinListAccessCountTest()
+{
+    Host::GpioPortModel porta(GPIOA);
+    Host::GpioPortModel portb(GPIOB);
+
+    using Pins = IO::PinList<IO::Pa0, IO::Pa1, IO::Pb5, IO::Pb6>;
+    {
+        Host::ScopedAccessTrace trace;
+        Pins::Write(0b1010);
+    }
+    // One BSRR write per port, no reads
+    assert(AccessTrace::Count(GPIOA->BSRR) == (AccessCounters{.Writes = 1}));
+    assert(AccessTrace::Count(GPIOB->BSRR) == (AccessCounters{.Writes = 1}));
+    assert(AccessTrace::Total().Total() == 2);
+
+    {
+        Host::ScopedAccessTrace trace;
+        Pins::WriteByTable(0b0101);
+    }
+    // Table lookup is not bus access: one BSRR write per port
+    assert(AccessTrace::Count(GPIOA->BSRR) == (AccessCounters{.Writes = 1}));
+    assert(AccessTrace::Count(GPIOB->BSRR) == (AccessCounters{.Writes = 1}));
+    assert(AccessTrace::Total().Total() == 2);
+
+    {
+        Host::ScopedAccessTrace trace;
+        IO::Porta::Toggle(0x01);
+    }
+#if defined(GPIO_CRL_MODE0)
+    // ODR read-modify-write
+    assert(AccessTrace::Count(GPIOA->ODR) == (AccessCounters{.Reads = 1, .Writes = 1, .ReadModifyWrites = 1}));
+#else
+    // ODR read, BSRR write
+    assert(AccessTrace::Count(GPIOA->ODR) == (AccessCounters{.Reads = 1}));
+    assert(AccessTrace::Count(GPIOA->BSRR) == (AccessCounters{.Writes = 1}));
+#endif
+    assert(AccessTrace::Total().Total() == 2);
+}
+
+void PinConfigurationAccessCountTest()
+{
+    {
+        Host::ScopedAccessTrace trace;
+        BoardPins::Apply();
+    }
+    // Each configuration register is written once, partially configured registers are read once
+    constexpr AccessCounters Rmw {.Reads = 1, .Writes = 1, .ReadModifyWrites = 1};
+#if defined(GPIO_CRL_MODE0)
+    assert(AccessTrace::Count(GPIOA->CRL) == Rmw);
+    assert(AccessTrace::Count(GPIOA->CRH) == Rmw);
+    assert(AccessTrace::Count(GPIOA->BSRR) == (AccessCounters{.Writes = 1}));
+    assert(AccessTrace::Count(GPIOB->CRL) == Rmw);
+    assert(AccessTrace::Count(GPIOB->CRH) == AccessCounters{});
+    assert(AccessTrace::Count(GPIOB->BSRR) == (AccessCounters{.Writes = 1}));
+#else
+    assert(AccessTrace::Count(GPIOA->MODER) == Rmw);
+    assert(AccessTrace::Count(GPIOA->OTYPER) == Rmw);
+    assert(AccessTrace::Count(GPIOA->OSPEEDR) == Rmw);
+    assert(AccessTrace::Count(GPIOA->PUPDR) == Rmw);
+    assert(AccessTrace::Count(GPIOA->AFR[0]) == AccessCounters{});
+    assert(AccessTrace::Count(GPIOA->AFR[1]) == Rmw);
+    assert(AccessTrace::Count(GPIOB->MODER) == Rmw);
+    assert(AccessTrace::Count(GPIOB->OTYPER) == AccessCounters{});
+    assert(AccessTrace::Count(GPIOB->PUPDR) == Rmw);
+#endif
+}
+
+void UsartAccessCountTest()
+{
+    Host::FlagModel status(Host::AddressOf(&Usart1::Regs::Get()->STATUS_REG), Usart1::TxEmptyInt | Usart1::TxCompleteInt);
+    Usart1::Init(115200);
+
+    {
+        Host::ScopedAccessTrace trace;
+        Usart1::Write("Zhele", 5);
+    }
+    // Per byte: CR3 read (DMA check), status read, data write
+    auto regs = Usart1::Regs::Get();
+    assert(AccessTrace::Count(regs->CR3) == (AccessCounters{.Reads = 5}));
+    assert(AccessTrace::Count(regs->STATUS_REG) == (AccessCounters{.Reads = 5}));
+    assert(AccessTrace::Count(regs->TRANSMIT_DATA_REG) == (AccessCounters{.Writes = 5}));
+    assert(AccessTrace::Total().Total() == 15);
+}
+
+void SpiAccessCountTest()
+{
+    Host::FlagModel status(Host::AddressOf(&SPI1->SR), SPI_SR_TXE | SPI_SR_RXNE, SPI_SR_BSY);
+    Spi1::Init();
+
+    {
+        Host::ScopedAccessTrace trace;
+        Spi1::Send(0x5a);
+    }
+    // TXE and RXNE polling, frame size check, data write and read
+    assert(AccessTrace::Count(SPI1->SR) == (AccessCounters{.Reads = 2}));
+#if defined(SPI_CR1_DFF)
+    assert(AccessTrace::Count(SPI1->CR1) == (AccessCounters{.Reads = 1}));
+#else
+    assert(AccessTrace::Count(SPI1->CR2) == (AccessCounters{.Reads = 1}));
+#endif
+    assert(AccessTrace::Count(SPI1->DR) == (AccessCounters{.Reads = 1, .Writes = 1}));
+    assert(AccessTrace::Total().Total() == 5);
+
+    uint8_t buffer[8] {};
+    {
+        Host::ScopedAccessTrace trace;
+        Spi1::Transfer(buffer, buffer, sizeof(buffer));
+    }
+#if defined(SPI_CR2_FRXTH)
+    // Frames are packed by two, FRXTH is cleared and set back
+    assert(AccessTrace::Count(SPI1->SR) == (AccessCounters{.Reads = 4}));
+    assert(AccessTrace::Count(SPI1->DR) == (AccessCounters{.Reads = 4, .Writes = 4}));
+#else
+    // No frame size checks: one status read per frame
+    assert(AccessTrace::Count(SPI1->SR) == (AccessCounters{.Reads = 8}));
+    assert(AccessTrace::Count(SPI1->DR) == (AccessCounters{.Reads = 8, .Writes = 8}));
+    assert(AccessTrace::Total().Total() == 24);
+#endif
+}
+
+#if defined(USB_PMAADDR)
+namespace
+{
+    IO_REG_WRAPPER(USB->EP1R, UsbEp1Reg, uint16_t);
+}
+
+void EndpointWriterAccessCountTest()
+{
+    using Ep = Usb::Endpoint<Usb::InEndpointBase<1, Usb::EndpointType::Interrupt, 8, 0>, UsbEp1Reg>;
+    constexpr uint32_t CountRegAddress = USB_PMAADDR + Usb::PmaAlignMultiplier * 10;
+    constexpr uint32_t BufferAddress = USB_PMAADDR + Usb::PmaAlignMultiplier * 64;
+    using Writer = Usb::EndpointWriter<Ep, BufferAddress, CountRegAddress>;
+
+    static const uint8_t packet[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    {
+        Host::ScopedAccessTrace trace;
+        Writer::SendData(packet, sizeof(packet));
+    }
+    // Packet copy (one 16-bit write per half-word at most), count write, EPnR read-modify-write
+    auto buffer = AccessTrace::Count(BufferAddress, Usb::PmaAlignMultiplier * sizeof(packet));
+    assert(buffer.Reads == 0 && buffer.Writes > 0 && buffer.Writes <= sizeof(packet) / 2);
+    assert(AccessTrace::Count(CountRegAddress, sizeof(uint16_t)) == (AccessCounters{.Writes = 1}));
+    assert(AccessTrace::Count(USB->EP1R) == (AccessCounters{.Reads = 1, .Writes = 1, .ReadModifyWrites = 1}));
+    assert(AccessTrace::Total().Total() == buffer.Writes + 3);
+}
+#endif
+
+int main()
+{
+    assert(Host::DeviceWindowsMapped);
+
+    SpscRingBufferHostTest();
+    Host::RegisterFile::Reset();
+    GpioHostTest();
+    Host::RegisterFile::Reset();
+    PinConfigurationHostTest();
+    Host::RegisterFile::Reset();
+    UsartHostTest();
+    Host::RegisterFile::Reset();
+    UsartStreamHostTest();
+    Host::RegisterFile::Reset();
+    UsartTxQueueHostTest();
+    Host::RegisterFile::Reset();
+    SpiHostTest();
+    Host::RegisterFile::Reset();
+    SpiBusHostTest();
+    Host::RegisterFile::Reset();
+    BitBandHostTest();
+    Host::RegisterFile::Reset();
+    DelayHostTest();
+#if !defined(DWT_CTRL_CYCCNTENA_Msk)
+    Host::RegisterFile::Reset();
+    CycleCounterSysTickHostTest();
+#endif
+    Host::RegisterFile::Reset();
+    SoftSpiHostTest();
+    Host::RegisterFile::Reset();
+    SoftI2cHostTest();
+#if defined(I2C_SR2_BUSY)
+    Host::RegisterFile::Reset();
+    I2cHostTest();
+#endif
+#if defined(I2C_ISR_TCR)
+    Host::RegisterFile::Reset();
+    I2cReloadHostTest();
+#endif
+    Host::RegisterFile::Reset();
+    DmaHostTest();
+#if defined(DMA_SxCR_DBM)
+    Host::RegisterFile::Reset();
+    DmaDoubleBufferHostTest();
+#endif
+    Host::RegisterFile::Reset();
+    DmaMemoryHostTest();
+    Host::RegisterFile::Reset();
+    TimerDmaBurstHostTest();
+    Host::RegisterFile::Reset();
+    PulseCaptureHostTest();
+    Host::RegisterFile::Reset();
+    TimerWheelHostTest();
+    Host::RegisterFile::Reset();
+    MonotonicClockHostTest();
+    Host::RegisterFile::Reset();
+    TicklessIdleHostTest();
+
+    Host::RegisterFile::Reset();
+    PinListAccessCountTest();
+    Host::RegisterFile::Reset();
+    PinConfigurationAccessCountTest();
+    Host::RegisterFile::Reset();
+    UsartAccessCountTest();
+    Host::RegisterFile::Reset();
+    SpiAccessCountTest();
+#if defined(USB_PMAADDR)
+    Host::RegisterFile::Reset();
+    EndpointWriterAccessCountTest();
+#endif
+
+    return 0;
+}